@@ -74,6 +74,26 @@ static inline void spi_end(void) {
 #define spi_end()   ///< Create dummy Macro Function
 #endif
 
+#if RA8875_SPI_STATS
+/// Add n to one of the SPI traffic counters, if enableSpiStats() is on
+#define RA8875_COUNT(field, n) \
+  do {                         \
+    if (_spiStatsOn)           \
+      _spiStats.field += (n);  \
+  } while (0)
+#else
+#define RA8875_COUNT(field, n) ///< SPI traffic counting is disabled
+#endif
+
+/// Registers mirrored by the shadow register cache, see enableRegisterCache()
+static const uint8_t shadowRegs[RA8875_SHADOW_REGS] = {
+    RA8875_SYSR,  0x21,        0x22,         RA8875_MWCR0,
+    RA8875_INTC1, RA8875_DPCR, RA8875_MWCR1, RA8875_LTPR0};
+
+/// 4x4 ordered dither thresholds used by setDither()
+static const uint8_t bayer4[4][4] = {
+    {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
 /**************************************************************************/
 /*!
       Constructor for a new RA8875 instance
@@ -86,6 +106,39 @@ Adafruit_RA8875::Adafruit_RA8875(uint8_t CS, uint8_t RST)
     : Adafruit_GFX(800, 480) {
   _cs = CS;
   _rst = RST;
+  _width = 800;
+  _height = 480;
+  _initialized = false;
+  _burstDepth = 0;
+  _timedOut = false;
+  _shadowEnabled = false;
+  _writeCache = false;
+  _curReg = 0;
+  _skippedWrites = 0;
+  _async = false;
+  _busyReg = 0;
+  _waitPin = -1;
+  _intPin = -1;
+  _pollTimeout = RA8875_POLL_TIMEOUT;
+  _pollBackoffMin = 0;
+  _pollBackoffMax = 0;
+  _pollCount = 0;
+  _spiStatsOn = false;
+  clearSpiStats();
+  _runLen = 0;
+  _layer = RA8875_LAYER1;
+  _displayLayer = RA8875_LAYER1;
+  _vsyncPin = -1;
+  _doubleBuffer = false;
+  _bpp = 16;
+  _dither = false;
+  ditherStart(0, 0, 1);
+  _clipX0 = _clipY0 = 0;
+  _clipX1 = _clipY1 = -1;
+  _rotation = 0;
+  _assetTick = 0;
+  setAssetCache(RA8875_LAYER2, 0, 0, 0, 0);
+  invalidateRegisterCache();
 }
 
 /**************************************************************************/
@@ -119,7 +172,15 @@ boolean Adafruit_RA8875::begin(enum RA8875sizes s) {
   } else {
     return false;
   }
-  _rotation = 0;
+  _layer = RA8875_LAYER1;
+  _displayLayer = RA8875_LAYER1;
+  _bpp = 16;
+  _clipX0 = _clipY0 = 0;
+  _clipX1 = width() - 1;
+  _clipY1 = height() - 1;
+  Adafruit_GFX::_width = width();
+  Adafruit_GFX::_height = height();
+  invalidateRegisterCache();
   pinMode(_cs, OUTPUT);
   digitalWrite(_cs, HIGH);
   pinMode(_rst, OUTPUT);
@@ -158,6 +219,11 @@ boolean Adafruit_RA8875::begin(enum RA8875sizes s) {
   }
 
   initialize();
+  _initialized = true;
+
+  /* Apply a rotation set before begin() */
+  if (_rotation)
+    rotationHelper();
 
 #ifdef SPI_HAS_TRANSACTION
 /// @cond DISABLE
@@ -188,6 +254,9 @@ void Adafruit_RA8875::softReset(void) {
   writeData(RA8875_PWRR_SOFTRESET);
   writeData(RA8875_PWRR_NORMAL);
   delay(1);
+  _layer = RA8875_LAYER1;
+  _displayLayer = RA8875_LAYER1;
+  invalidateRegisterCache();
 }
 
 /**************************************************************************/
@@ -217,7 +286,9 @@ void Adafruit_RA8875::PLLinit(void) {
 /**************************************************************************/
 void Adafruit_RA8875::initialize(void) {
   PLLinit();
-  writeReg(RA8875_SYSR, RA8875_SYSR_16BPP | RA8875_SYSR_MCU8);
+  writeReg(RA8875_SYSR,
+           (_bpp == 8 ? RA8875_SYSR_8BPP : RA8875_SYSR_16BPP) |
+               RA8875_SYSR_MCU8);
 
   /* Timing values */
   uint8_t pixclk;
@@ -314,7 +385,7 @@ void Adafruit_RA8875::initialize(void) {
 */
 /**************************************************************************/
 uint16_t Adafruit_RA8875::width(void) {
-  return _width;
+  return (_rotation & 1) ? _height : _width;
 }
 
 /**************************************************************************/
@@ -325,7 +396,7 @@ uint16_t Adafruit_RA8875::width(void) {
 */
 /**************************************************************************/
 uint16_t Adafruit_RA8875::height(void) {
-  return _height;
+  return (_rotation & 1) ? _width : _height;
 }
 
 /**************************************************************************/
@@ -341,20 +412,52 @@ int8_t Adafruit_RA8875::getRotation(void) {
 
 /**************************************************************************/
 /*!
- Sets the current rotation (0-3)
+ Sets the current rotation (0-3). Rotations 1 and 3 are portrait, with
+ width() and height() swapped. The controller's 90 degree font rotation
+ writes text transposed, so portrait rotations keep display memory
+ transposed as well and the panel scan direction turns it the right way
+ round: columns are scanned in reverse at rotation 1, rows at rotation 3,
+ and both at rotation 2. Graphics and text mode then agree at every
+ rotation. May be called before begin(), which then applies it. Display
+ memory is not redrawn, so clear the screen after a change.
 
  @param rotation The Rotation Setting
  */
 /**************************************************************************/
 void Adafruit_RA8875::setRotation(int8_t rotation) {
-  switch (rotation) {
-    case 2:
-      _rotation = rotation;
-      break;
-    default:
-      _rotation = 0;
-      break;
-  }
+  uint8_t old = _rotation;
+  _rotation = rotation & 3;
+  Adafruit_GFX::_width = width();
+  Adafruit_GFX::_height = height();
+
+  if ((_rotation == old) || !_initialized)
+    return;
+
+  /* Cached assets and the clip rectangle were set for the old orientation */
+  clearAssetCache();
+  sync();
+  rotationHelper();
+  resetClip();
+}
+
+/**************************************************************************/
+/*!
+ Writes the font rotation and panel scan directions for the current
+ rotation
+ */
+/**************************************************************************/
+void Adafruit_RA8875::rotationHelper(void) {
+  static const uint8_t scan[4] = {0, RA8875_DPCR_HDIR,
+                                  RA8875_DPCR_HDIR | RA8875_DPCR_VDIR,
+                                  RA8875_DPCR_VDIR};
+  beginBurst();
+  writeReg(0x22, (readShadowReg(0x22) & ~(1 << 4)) |
+                     ((_rotation & 1) ? (1 << 4) : 0));
+  writeReg(RA8875_DPCR,
+           (readShadowReg(RA8875_DPCR) &
+            ~(RA8875_DPCR_HDIR | RA8875_DPCR_VDIR)) |
+               scan[_rotation]);
+  endBurst();
 }
 
 /************************* Text Mode ***********************************/
@@ -365,17 +468,18 @@ void Adafruit_RA8875::setRotation(int8_t rotation) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::textMode(void) {
+  sync();
+  beginBurst();
   /* Set text mode */
-  writeCommand(RA8875_MWCR0);
-  uint8_t temp = readData();
+  uint8_t temp = readShadowReg(RA8875_MWCR0);
   temp |= RA8875_MWCR0_TXTMODE; // Set bit 7
-  writeData(temp);
+  writeReg(RA8875_MWCR0, temp);
 
   /* Select the internal (ROM) font */
-  writeCommand(0x21);
-  temp = readData();
+  temp = readShadowReg(0x21);
   temp &= ~((1 << 7) | (1 << 5)); // Clear bits 7 and 5
-  writeData(temp);
+  writeReg(0x21, temp);
+  endBurst();
 }
 
 /**************************************************************************/
@@ -387,18 +491,15 @@ void Adafruit_RA8875::textMode(void) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::textSetCursor(uint16_t x, uint16_t y) {
-  x = applyRotationX(x);
-  y = applyRotationY(y);
+  int16_t cx = x, cy = y;
+  sync();
+  applyRotation(cx, cy);
 
   /* Set cursor location */
-  writeCommand(0x2A);
-  writeData(x & 0xFF);
-  writeCommand(0x2B);
-  writeData(x >> 8);
-  writeCommand(0x2C);
-  writeData(y & 0xFF);
-  writeCommand(0x2D);
-  writeData(y >> 8);
+  beginBurst();
+  writeReg16(0x2A, cx);
+  writeReg16(0x2C, cy);
+  endBurst();
 }
 
 /**************************************************************************/
@@ -410,27 +511,21 @@ void Adafruit_RA8875::textSetCursor(uint16_t x, uint16_t y) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::textColor(uint16_t foreColor, uint16_t bgColor) {
+  sync();
+  beginBurst();
   /* Set Fore Color */
-  writeCommand(0x63);
-  writeData((foreColor & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((foreColor & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((foreColor & 0x001f));
+  writeColor(0x63, foreColor);
 
   /* Set Background Color */
-  writeCommand(0x60);
-  writeData((bgColor & 0xf800) >> 11);
-  writeCommand(0x61);
-  writeData((bgColor & 0x07e0) >> 5);
-  writeCommand(0x62);
-  writeData((bgColor & 0x001f));
+  writeColor(0x60, bgColor);
 
   /* Clear transparency flag */
-  writeCommand(0x22);
-  uint8_t temp = readData();
-  temp &= ~(1 << 6); // Clear bit 6
-  writeData(temp);
+  if (!_writeCache || (_textTransparent != 0)) {
+    uint8_t temp = readShadowReg(0x22);
+    temp &= ~(1 << 6); // Clear bit 6
+    writeReg(0x22, temp);
+  }
+  endBurst();
 }
 
 /**************************************************************************/
@@ -441,19 +536,18 @@ void Adafruit_RA8875::textColor(uint16_t foreColor, uint16_t bgColor) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::textTransparent(uint16_t foreColor) {
+  sync();
+  beginBurst();
   /* Set Fore Color */
-  writeCommand(0x63);
-  writeData((foreColor & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((foreColor & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((foreColor & 0x001f));
+  writeColor(0x63, foreColor);
 
   /* Set transparency flag */
-  writeCommand(0x22);
-  uint8_t temp = readData();
-  temp |= (1 << 6); // Set bit 6
-  writeData(temp);
+  if (!_writeCache || (_textTransparent != 1)) {
+    uint8_t temp = readShadowReg(0x22);
+    temp |= (1 << 6); // Set bit 6
+    writeReg(0x22, temp);
+  }
+  endBurst();
 }
 
 /**************************************************************************/
@@ -469,17 +563,17 @@ void Adafruit_RA8875::textTransparent(uint16_t foreColor) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::textEnlarge(uint8_t scale) {
+  sync();
   if (scale > 3)
     scale = 3; // highest setting is 3
 
   /* Set font size flags */
-  writeCommand(0x22);
-  uint8_t temp = readData();
+  uint8_t temp = readShadowReg(0x22);
   temp &= ~(0xF); // Clears bits 0..3
   temp |= scale << 2;
   temp |= scale;
 
-  writeData(temp);
+  writeReg(0x22, temp);
 
   _textScale = scale;
 }
@@ -499,15 +593,10 @@ void Adafruit_RA8875::textEnlarge(uint8_t scale) {
 /**************************************************************************/
 
 void Adafruit_RA8875::cursorBlink(uint8_t rate) {
-  writeCommand(RA8875_MWCR0);
-  uint8_t temp = readData();
-  temp |= RA8875_MWCR0_CURSOR;
-  writeData(temp);
-
-  writeCommand(RA8875_MWCR0);
-  temp = readData();
-  temp |= RA8875_MWCR0_BLINK;
-  writeData(temp);
+  sync();
+  uint8_t temp = readShadowReg(RA8875_MWCR0);
+  temp |= RA8875_MWCR0_CURSOR | RA8875_MWCR0_BLINK;
+  writeReg(RA8875_MWCR0, temp);
 
   if (rate > 255)
     rate = 255;
@@ -524,27 +613,19 @@ void Adafruit_RA8875::cursorBlink(uint8_t rate) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::textWrite(const char* buffer, uint16_t len) {
+  sync();
   if (len == 0)
     len = strlen(buffer);
   writeCommand(RA8875_MRWC);
   for (uint16_t i = 0; i < len; i++) {
     writeData(buffer[i]);
-/// @cond DISABLE
-#if defined(__arm__)
-    /// @endcond
-    // This delay is needed with textEnlarge(1) because
-    // Teensy 3.X is much faster than Arduino Uno
-    if (_textScale > 0)
-      delay(1);
-/// @cond DISABLE
-#else
-    /// @endcond
-    // For others, delay starting with textEnlarge(2)
-    if (_textScale > 1)
+    // Enlarged glyphs take a while to render. MEMBUSY only covers the
+    // memory write, not the font ROM fetch, so keep the datasheet delay and
+    // then make sure the write has landed before sending the next character
+    if (_textScale > 0) {
       delay(1);
-/// @cond DISABLE
-#endif
-    /// @endcond
+      waitBusy(RA8875_STSR_MEMBUSY);
+    }
   }
 }
 
@@ -556,429 +637,1751 @@ void Adafruit_RA8875::textWrite(const char* buffer, uint16_t len) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::graphicsMode(void) {
-  writeCommand(RA8875_MWCR0);
-  uint8_t temp = readData();
+  sync();
+  uint8_t temp = readShadowReg(RA8875_MWCR0);
   temp &= ~RA8875_MWCR0_TXTMODE; // bit #7
-  writeData(temp);
+  writeReg(RA8875_MWCR0, temp);
 }
 
 /**************************************************************************/
 /*!
       Waits for screen to finish by polling the status!
 
+      The register is selected once and then read back with single data
+      cycles, so each poll costs one two-byte transaction. Polling gives up
+      after the timeout set with setPollTimeout().
+
       @param regname The register name to check
       @param waitflag The value to wait for the status register to match
 
-      @return True if the expected status has been reached
+      @return True if the expected status has been reached, false on timeout
 */
 /**************************************************************************/
 boolean Adafruit_RA8875::waitPoll(uint8_t regname, uint8_t waitflag) {
   /* Wait for the command to finish */
-  while (1) {
-    uint8_t temp = readReg(regname);
-    if (!(temp & waitflag))
-      return true;
-  }
-  return false; // MEMEFIX: yeah i know, unreached! - add timeout?
+  writeCommand(regname);
+  return pollHelper(regname, waitflag);
 }
 
 /**************************************************************************/
 /*!
-      Sets the current X/Y position on the display before drawing
+      Waits for bits in the status register to clear. Each poll is a single
+      readStatus() transaction. When a WAIT or INT pin has been set up with
+      setWaitPin()/setIntPin(), memory and BTE waits watch the pin instead
+      and leave the SPI bus alone.
 
-      @param x The 0-based x location
-      @param y The 0-base y location
+      @param mask The RA8875_STSR_* busy bits to wait for
+
+      @return True if the bits cleared, false on timeout
 */
 /**************************************************************************/
-void Adafruit_RA8875::setXY(uint16_t x, uint16_t y) {
-  writeReg(RA8875_CURH0, x);
-  writeReg(RA8875_CURH1, x >> 8);
-  writeReg(RA8875_CURV0, y);
-  writeReg(RA8875_CURV1, y >> 8);
+boolean Adafruit_RA8875::waitBusy(uint8_t mask) {
+  return pollHelper(-1, mask);
 }
 
 /**************************************************************************/
 /*!
-      HW accelerated function to push a chunk of raw pixel data
+      Polling loop shared by waitPoll() and waitBusy()
 
-      @param num The number of pixels to push
-      @param p   The pixel color to use
+      @param regname The selected register to read with data cycles, or -1
+                     to read the status register (or the WAIT/INT pins)
+      @param mask    The busy bits to wait for
+
+      @return True if the bits cleared, false on timeout
 */
 /**************************************************************************/
-void Adafruit_RA8875::pushPixels(uint32_t num, uint16_t p) {
-  digitalWrite(_cs, LOW);
-  SPI.transfer(RA8875_DATAWRITE);
-  while (num--) {
-    SPI.transfer(p >> 8);
-    SPI.transfer(p);
+boolean Adafruit_RA8875::pollHelper(int16_t regname, uint8_t mask) {
+  unsigned long start = millis();
+  uint16_t backoff = _pollBackoffMin;
+
+  while (1) {
+    _pollCount++;
+    boolean busy;
+    if (regname >= 0) {
+      busy = readData() & mask;
+    } else if (mask == RA8875_STSR_MEMBUSY && _waitPin >= 0) {
+      busy = (digitalRead(_waitPin) == LOW);
+    } else if (mask == RA8875_STSR_BTEBUSY && _intPin >= 0) {
+      busy = true;
+      if (digitalRead(_intPin) == LOW) {
+        if (readReg(RA8875_INTC2) & RA8875_INTC2_BTE) {
+          /* Clear BTE INT Status */
+          writeReg(RA8875_INTC2, RA8875_INTC2_BTE);
+          busy = false;
+        } else {
+          // Another interrupt (e.g. touch) is holding INT low
+          busy = readStatus() & mask;
+        }
+      }
+    } else {
+      busy = readStatus() & mask;
+    }
+    if (!busy)
+      return true;
+    if (!pollDelay(start, backoff)) {
+      _timedOut = true;
+      return false;
+    }
   }
-  digitalWrite(_cs, HIGH);
 }
 
 /**************************************************************************/
 /*!
-    Fill the screen with the current color
+      Sleep between two status polls, doubling the backoff each time. When
+      called inside a burst the SPI bus is released for the duration of the
+      sleep, so other devices on the bus are not locked out by a long wait.
+
+      @param start   The millis() value when polling started
+      @param backoff The current backoff in microseconds, updated in place
+
+      @return False if the poll timeout has expired
 */
 /**************************************************************************/
-void Adafruit_RA8875::fillRect(void) {
-  writeCommand(RA8875_DCR);
-  writeData(RA8875_DCR_LINESQUTRI_STOP | RA8875_DCR_DRAWSQUARE);
-  writeData(RA8875_DCR_LINESQUTRI_START | RA8875_DCR_FILL |
-            RA8875_DCR_DRAWSQUARE);
+boolean Adafruit_RA8875::pollDelay(unsigned long start, uint16_t& backoff) {
+  if (_pollTimeout && (millis() - start) >= _pollTimeout)
+    return false;
+  if (backoff) {
+    if (_burstDepth)
+      spi_end();
+    delayMicroseconds(backoff);
+    if (_burstDepth) {
+      spi_begin();
+      RA8875_COUNT(transactions, 1);
+    }
+    backoff = (backoff < _pollBackoffMax / 2) ? backoff * 2 : _pollBackoffMax;
+  }
+  return true;
 }
 
 /**************************************************************************/
 /*!
-    Apply current rotation in the X direction
+      Checks whether a wait has given up since the last call. Primitives
+      that wait on the draw engine cannot return an error themselves, so a
+      timeout is latched here until it is read.
 
-    @return the X value with current rotation applied
- */
+      @return True if waitPoll(), waitBusy() or the VSYNC wait of present()
+              timed out, clears the flag
+*/
 /**************************************************************************/
-int16_t Adafruit_RA8875::applyRotationX(int16_t x) {
-  switch (_rotation) {
-    case 2:
-      x = _width - 1 - x;
-      break;
-  }
-
-  return x;
+boolean Adafruit_RA8875::timedOut(void) {
+  boolean t = _timedOut;
+  _timedOut = false;
+  return t;
 }
 
 /**************************************************************************/
 /*!
-    Apply current rotation in the Y direction
+      Sets how long waitPoll() and waitBusy() keep polling before giving up
 
-    @return the Y value with current rotation applied
- */
+      @param ms Timeout in milliseconds, 0 to wait forever
+*/
 /**************************************************************************/
-int16_t Adafruit_RA8875::applyRotationY(int16_t y) {
-  switch (_rotation) {
-    case 2:
-      y = _height - 1 - y;
-      break;
-  }
-
-  return y + _voffset;
+void Adafruit_RA8875::setPollTimeout(uint16_t ms) {
+  _pollTimeout = ms;
 }
 
 /**************************************************************************/
 /*!
-      Draws a single pixel at the specified location
+      Sets the delay between status polls. The delay starts at minUs and
+      doubles after every poll up to maxUs, which lowers bus occupancy while
+      waiting for long operations like full screen fills.
 
-      @param x     The 0-based x location
-      @param y     The 0-base y location
-      @param color The RGB565 color to use when drawing the pixel
+      @param minUs Initial delay in microseconds, 0 to poll continuously
+      @param maxUs Maximum delay in microseconds
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  x = applyRotationX(x);
-  y = applyRotationY(y);
-
-  writeReg(RA8875_CURH0, x);
-  writeReg(RA8875_CURH1, x >> 8);
-  writeReg(RA8875_CURV0, y);
-  writeReg(RA8875_CURV1, y >> 8);
-  writeCommand(RA8875_MRWC);
-  digitalWrite(_cs, LOW);
-  SPI.transfer(RA8875_DATAWRITE);
-  SPI.transfer(color >> 8);
-  SPI.transfer(color);
-  digitalWrite(_cs, HIGH);
+void Adafruit_RA8875::setPollBackoff(uint16_t minUs, uint16_t maxUs) {
+  _pollBackoffMin = minUs;
+  _pollBackoffMax = maxUs;
 }
 
 /**************************************************************************/
 /*!
- Draws a series of pixels at the specified location without the overhead
+      Use the RA8875 WAIT pin to detect a busy memory interface instead of
+      polling the status register
 
- @param p     An array of RGB565 color pixels
- @param num   The number of the pixels to draw
- @param x     The 0-based x location
- @param y     The 0-base y location
- */
+      @param pin The GPIO connected to WAIT, or -1 to disable
+*/
 /**************************************************************************/
-void Adafruit_RA8875::drawPixels(uint16_t* p, uint32_t num, int16_t x,
-                                 int16_t y) {
-  x = applyRotationX(x);
-  y = applyRotationY(y);
-
-  writeReg(RA8875_CURH0, x);
-  writeReg(RA8875_CURH1, x >> 8);
-  writeReg(RA8875_CURV0, y);
-  writeReg(RA8875_CURV1, y >> 8);
+void Adafruit_RA8875::setWaitPin(int8_t pin) {
+  _waitPin = pin;
+  if (pin >= 0)
+    pinMode(pin, INPUT_PULLUP);
+}
 
-  uint8_t dir = RA8875_MWCR0_LRTD;
-  if (_rotation == 2) {
-    dir = RA8875_MWCR0_RLTD;
-  }
-  writeReg(RA8875_MWCR0, (readReg(RA8875_MWCR0) & ~RA8875_MWCR0_DIRMASK) | dir);
+/**************************************************************************/
+/*!
+      Use the RA8875 INT pin to detect BTE completion instead of polling
+      the status register. This enables the BTE interrupt.
 
-  writeCommand(RA8875_MRWC);
-  digitalWrite(_cs, LOW);
-  SPI.transfer(RA8875_DATAWRITE);
-  while (num--) {
-    SPI.transfer16(*p++);
+      @param pin The GPIO connected to INT, or -1 to disable
+*/
+/**************************************************************************/
+void Adafruit_RA8875::setIntPin(int8_t pin) {
+  _intPin = pin;
+  if (pin >= 0) {
+    pinMode(pin, INPUT_PULLUP);
+    writeReg(RA8875_INTC1, readShadowReg(RA8875_INTC1) | RA8875_INTC1_BTE);
+  } else {
+    writeReg(RA8875_INTC1, readShadowReg(RA8875_INTC1) & ~RA8875_INTC1_BTE);
   }
-  digitalWrite(_cs, HIGH);
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated line on the display
+      Returns the number of status polls done by waitPoll() and waitBusy()
 
-      @param x0    The 0-based starting x location
-      @param y0    The 0-base starting y location
-      @param x1    The 0-based ending x location
-      @param y1    The 0-base ending y location
-      @param color The RGB565 color to use when drawing the pixel
+      @return The poll count since the last clearPollCount()
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
-                               uint16_t color) {
-  x0 = applyRotationX(x0);
-  y0 = applyRotationY(y0);
-  x1 = applyRotationX(x1);
-  y1 = applyRotationY(y1);
-
-  /* Set X */
-  writeCommand(0x91);
-  writeData(x0);
-  writeCommand(0x92);
-  writeData(x0 >> 8);
-
-  /* Set Y */
-  writeCommand(0x93);
-  writeData(y0);
-  writeCommand(0x94);
-  writeData(y0 >> 8);
-
-  /* Set X1 */
-  writeCommand(0x95);
-  writeData(x1);
-  writeCommand(0x96);
-  writeData((x1) >> 8);
-
-  /* Set Y1 */
-  writeCommand(0x97);
-  writeData(y1);
-  writeCommand(0x98);
-  writeData((y1) >> 8);
-
-  /* Set Color */
-  writeCommand(0x63);
-  writeData((color & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((color & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((color & 0x001f));
-
-  /* Draw! */
-  writeCommand(RA8875_DCR);
-  writeData(0x80);
+uint32_t Adafruit_RA8875::pollCount(void) {
+  return _pollCount;
+}
 
-  /* Wait for the command to finish */
-  waitPoll(RA8875_DCR, RA8875_DCR_LINESQUTRI_STATUS);
+/**************************************************************************/
+/*!
+      Reset the status poll counter
+*/
+/**************************************************************************/
+void Adafruit_RA8875::clearPollCount(void) {
+  _pollCount = 0;
 }
 
 /**************************************************************************/
 /*!
-    Draw a vertical line
+      Turns the SPI traffic counters on or off. They are off by default so
+      normal drawing does not pay for the bookkeeping. Builds with
+      RA8875_SPI_STATS set to 0 have no counters and always report 0.
 
-    @param x The X position
-    @param y The Y position
-    @param h Height
-    @param color The color
+      @param on Whether to count SPI traffic
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawFastVLine(int16_t x, int16_t y, int16_t h,
-                                    uint16_t color) {
-  drawLine(x, y, x, y + h, color);
+void Adafruit_RA8875::enableSpiStats(boolean on) {
+  _spiStatsOn = on;
 }
 
 /**************************************************************************/
 /*!
-     Draw a horizontal line
+      Returns the SPI traffic counters, useful for comparing the bus
+      traffic of different drawing calls. They only count while
+      enableSpiStats() is on.
 
-     @param x The X position
-     @param y The Y position
-     @param w Width
-     @param color The color
+      @return The counters since the last clearSpiStats()
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawFastHLine(int16_t x, int16_t y, int16_t w,
-                                    uint16_t color) {
-  drawLine(x, y, x + w, y, color);
+tsSpiStats_t Adafruit_RA8875::spiStats(void) {
+  return _spiStats;
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated rectangle on the display
-
-      @param x     The 0-based x location of the top-right corner
-      @param y     The 0-based y location of the top-right corner
-      @param w     The rectangle width
-      @param h     The rectangle height
-      @param color The RGB565 color to use when drawing the pixel
+      Reset the SPI traffic counters
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
-                               uint16_t color) {
-  rectHelper(x, y, x + w - 1, y + h - 1, color, false);
+void Adafruit_RA8875::clearSpiStats(void) {
+  _spiStats.transactions = 0;
+  _spiStats.frames = 0;
+  _spiStats.bytes = 0;
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated filled rectangle on the display
+      Enables or disables asynchronous drawing. In asynchronous mode the HW
+      accelerated primitives return as soon as the draw engine has been
+      started, and the wait for it to finish is deferred until the next call
+      that needs the engine or display memory (or an explicit sync()).
 
-      @param x     The 0-based x location of the top-right corner
-      @param y     The 0-based y location of the top-right corner
-      @param w     The rectangle width
-      @param h     The rectangle height
-      @param color The RGB565 color to use when drawing the pixel
+      @param on Whether to draw asynchronously
 */
 /**************************************************************************/
-void Adafruit_RA8875::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
-                               uint16_t color) {
-  rectHelper(x, y, x + w - 1, y + h - 1, color, true);
+void Adafruit_RA8875::setAsync(boolean on) {
+  if (!on)
+    sync();
+  _async = on;
 }
 
 /**************************************************************************/
 /*!
-      Fills the screen with the spefied RGB565 color
+      Waits for any pending asynchronous draw operation to finish
 
-      @param color The RGB565 color to use when drawing the pixel
+      @return True if the draw engine finished, false if the wait timed out
 */
 /**************************************************************************/
-void Adafruit_RA8875::fillScreen(uint16_t color) {
-  rectHelper(0, 0, _width - 1, _height - 1, color, true);
+boolean Adafruit_RA8875::sync(void) {
+  boolean ok = true;
+  if (_busyReg) {
+    uint8_t reg = _busyReg;
+    _busyReg = 0;
+    ok = finishEngine(reg, _busyFlag);
+  }
+  if (_runLen)
+    flushRun();
+  return ok;
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated circle on the display
+      Checks whether an asynchronous draw operation is still running,
+      without waiting for it
 
-      @param x     The 0-based x location of the center of the circle
-      @param y     The 0-based y location of the center of the circle
-      @param r     The circle's radius
-      @param color The RGB565 color to use when drawing the pixel
+      @return True if the draw engine is still busy
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawCircle(int16_t x, int16_t y, int16_t r,
-                                 uint16_t color) {
-  circleHelper(x, y, r, color, false);
+boolean Adafruit_RA8875::isBusy(void) {
+  if (_busyReg && !(readReg(_busyReg) & _busyFlag))
+    _busyReg = 0;
+  return _busyReg != 0;
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated filled circle on the display
+      Waits for the draw engine after starting a primitive, or records the
+      status to wait on later when asynchronous drawing is enabled
 
-      @param x     The 0-based x location of the center of the circle
-      @param y     The 0-based y location of the center of the circle
-      @param r     The circle's radius
-      @param color The RGB565 color to use when drawing the pixel
+      @param regname The register name to check
+      @param waitflag The value to wait for the status register to match
+
+      @return False if the draw engine did not finish before the timeout
 */
 /**************************************************************************/
-void Adafruit_RA8875::fillCircle(int16_t x, int16_t y, int16_t r,
-                                 uint16_t color) {
-  circleHelper(x, y, r, color, true);
+boolean Adafruit_RA8875::waitEngine(uint8_t regname, uint8_t waitflag) {
+  if (_async) {
+    _busyReg = regname;
+    _busyFlag = waitflag;
+    return true;
+  }
+  return finishEngine(regname, waitflag);
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated triangle on the display
+      Waits for a draw engine operation to finish. BTE operations are
+      waited for with waitBusy(), so they can use the INT pin.
 
-      @param x0    The 0-based x location of point 0 on the triangle
-      @param y0    The 0-based y location of point 0 on the triangle
-      @param x1    The 0-based x location of point 1 on the triangle
-      @param y1    The 0-based y location of point 1 on the triangle
-      @param x2    The 0-based x location of point 2 on the triangle
-      @param y2    The 0-based y location of point 2 on the triangle
-      @param color The RGB565 color to use when drawing the pixel
+      @param regname The register name to check
+      @param waitflag The value to wait for the status register to match
+
+      @return False if the draw engine did not finish before the timeout
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawTriangle(int16_t x0, int16_t y0, int16_t x1,
-                                   int16_t y1, int16_t x2, int16_t y2,
-                                   uint16_t color) {
-  triangleHelper(x0, y0, x1, y1, x2, y2, color, false);
+boolean Adafruit_RA8875::finishEngine(uint8_t regname, uint8_t waitflag) {
+  if (regname == RA8875_BECR0)
+    return waitBusy(RA8875_STSR_BTEBUSY);
+  return waitPoll(regname, waitflag);
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated filled triangle on the display
+      Sets the current X/Y position on the display before drawing
 
-      @param x0    The 0-based x location of point 0 on the triangle
-      @param y0    The 0-based y location of point 0 on the triangle
-      @param x1    The 0-based x location of point 1 on the triangle
-      @param y1    The 0-based y location of point 1 on the triangle
-      @param x2    The 0-based x location of point 2 on the triangle
-      @param y2    The 0-based y location of point 2 on the triangle
-      @param color The RGB565 color to use when drawing the pixel
+      @param x The 0-based x location
+      @param y The 0-base y location
 */
 /**************************************************************************/
-void Adafruit_RA8875::fillTriangle(int16_t x0, int16_t y0, int16_t x1,
-                                   int16_t y1, int16_t x2, int16_t y2,
-                                   uint16_t color) {
-  triangleHelper(x0, y0, x1, y1, x2, y2, color, true);
+void Adafruit_RA8875::setXY(uint16_t x, uint16_t y) {
+  sync();
+  beginBurst();
+  writeReg16(RA8875_CURH0, x);
+  writeReg16(RA8875_CURV0, y);
+  endBurst();
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated ellipse on the display
+      Restricts drawing to a rectangle by programming the active window.
+      The draw engine, text and memory writes are clipped by the controller,
+      and windowed writes wrap rows at its edges. Bitmaps, pixels and cached
+      assets are clipped before they are sent. BTE moves are not clipped.
 
-      @param xCenter   The 0-based x location of the ellipse's center
-      @param yCenter   The 0-based y location of the ellipse's center
-      @param longAxis  The size in pixels of the ellipse's long axis
-      @param shortAxis The size in pixels of the ellipse's short axis
-      @param color     The RGB565 color to use when drawing the pixel
+      @param x The 0-based x location of the top-left corner
+      @param y The 0-based y location of the top-left corner
+      @param w The rectangle width
+      @param h The rectangle height
+
+      @return False if the rectangle is off screen, the clip is unchanged
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawEllipse(int16_t xCenter, int16_t yCenter,
-                                  int16_t longAxis, int16_t shortAxis,
-                                  uint16_t color) {
-  ellipseHelper(xCenter, yCenter, longAxis, shortAxis, color, false);
+boolean Adafruit_RA8875::setClipRect(int16_t x, int16_t y, int16_t w,
+                                     int16_t h) {
+  int32_t x1 = (int32_t)x + w - 1;
+  int32_t y1 = (int32_t)y + h - 1;
+  if (x < 0)
+    x = 0;
+  if (y < 0)
+    y = 0;
+  if (x1 >= width())
+    x1 = width() - 1;
+  if (y1 >= height())
+    y1 = height() - 1;
+  if ((x > x1) || (y > y1))
+    return false;
+
+  _clipX0 = x;
+  _clipY0 = y;
+  _clipX1 = x1;
+  _clipY1 = y1;
+  sync();
+  resetActiveWindow();
+  return true;
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated filled ellipse on the display
-
-      @param xCenter   The 0-based x location of the ellipse's center
-      @param yCenter   The 0-based y location of the ellipse's center
-      @param longAxis  The size in pixels of the ellipse's long axis
-      @param shortAxis The size in pixels of the ellipse's short axis
-      @param color     The RGB565 color to use when drawing the pixel
+      Removes the clip rectangle, drawing covers the whole display again
 */
 /**************************************************************************/
-void Adafruit_RA8875::fillEllipse(int16_t xCenter, int16_t yCenter,
-                                  int16_t longAxis, int16_t shortAxis,
-                                  uint16_t color) {
-  ellipseHelper(xCenter, yCenter, longAxis, shortAxis, color, true);
+void Adafruit_RA8875::resetClip(void) {
+  _clipX0 = _clipY0 = 0;
+  _clipX1 = width() - 1;
+  _clipY1 = height() - 1;
+  sync();
+  resetActiveWindow();
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated curve on the display
+      Reads a rectangle of the current layer back from display memory. All
+      pixels are read in one auto-incrementing memory read.
 
-      @param xCenter   The 0-based x location of the ellipse's center
-      @param yCenter   The 0-based y location of the ellipse's center
-      @param longAxis  The size in pixels of the ellipse's long axis
-      @param shortAxis The size in pixels of the ellipse's short axis
-      @param curvePart The corner to draw, where in clock-wise motion:
-                            0 = 180-270°
-                            1 = 270-0°
-                            2 = 0-90°
-                            3 = 90-180°
-      @param color     The RGB565 color to use when drawing the pixel
+      @param x   The 0-based x location of the top-left corner
+      @param y   The 0-based y location of the top-left corner
+      @param w   The rectangle width
+      @param h   The rectangle height
+      @param buf The buffer for the w * h RGB565 pixels, row by row
+
+      @return False if the rectangle is not entirely on screen
 */
 /**************************************************************************/
-void Adafruit_RA8875::drawCurve(int16_t xCenter, int16_t yCenter,
-                                int16_t longAxis, int16_t shortAxis,
-                                uint8_t curvePart, uint16_t color) {
-  curveHelper(xCenter, yCenter, longAxis, shortAxis, curvePart, color, false);
+boolean Adafruit_RA8875::readPixels(int16_t x, int16_t y, int16_t w, int16_t h,
+                                    uint16_t* buf) {
+  if ((w <= 0) || (h <= 0) || (x < 0) || (y < 0) ||
+      ((int32_t)x + w > width()) || ((int32_t)y + h > height()))
+    return false;
+
+  streamBegin(x, y, w, h, true);
+  readPixelData(buf, (uint32_t)w * h);
+  streamEnd();
+  return true;
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated filled curve on the display
+      Store a little-endian value in a byte buffer
+
+      @param p The destination
+      @param v The value
+      @param n The number of bytes
+*/
+/**************************************************************************/
+static void putLE(uint8_t* p, uint32_t v, uint8_t n) {
+  while (n--) {
+    *p++ = v;
+    v >>= 8;
+  }
+}
+
+/**************************************************************************/
+/*!
+      Tests one bit of a 1-bit bitmap
+
+      @param bits    The bitmap data
+      @param bit     The index of the bit
+      @param progmem Whether bits is in PROGMEM
+      @param xbm     Whether bits are LSB first (XBM) instead of MSB first
+
+      @return Whether the bit is set
+*/
+/**************************************************************************/
+static bool monoBit(const uint8_t* bits, uint32_t bit, bool progmem, bool xbm) {
+  uint8_t b = progmem ? pgm_read_byte(&bits[bit >> 3]) : bits[bit >> 3];
+  return b & (xbm ? (0x01 << (bit & 7)) : (0x80 >> (bit & 7)));
+}
+
+/**************************************************************************/
+/*!
+      Writes the current layer as a 16-bit (RGB565) BMP file. Pixels are
+      read in line buffer sized chunks and the bus is released before each
+      chunk is written, so out may be a file on an SD card sharing the SPI
+      bus. A large screenshot can be split over several calls to keep the
+      UI responsive:
+
+        int16_t row = 0;
+        while (row < tft.height())
+          row = tft.screenshot(file, row, 16);
+
+      @param out  The destination, e.g. a File or Serial
+      @param row  The first BMP row to write, 0 starts with the file header
+      @param rows The maximum number of rows to write in this call
+
+      @return The next row to write, height() when the image is complete
+*/
+/**************************************************************************/
+int16_t Adafruit_RA8875::screenshot(Print& out, int16_t row, int16_t rows) {
+  int16_t w = width(), h = height();
+  uint32_t stride = ((uint32_t)w * 2 + 3) & ~3UL;
+  uint16_t px[RA8875_LINEBUF_SIZE / 2];
+  uint8_t buf[RA8875_LINEBUF_SIZE];
+
+  if (row <= 0) {
+    /* BITMAPFILEHEADER, BITMAPINFOHEADER and the BI_BITFIELDS masks */
+    uint8_t hdr[66];
+    memset(hdr, 0, sizeof(hdr));
+    hdr[0] = 'B';
+    hdr[1] = 'M';
+    putLE(&hdr[2], sizeof(hdr) + stride * h, 4);
+    putLE(&hdr[10], sizeof(hdr), 4);
+    putLE(&hdr[14], 40, 4);
+    putLE(&hdr[18], w, 4);
+    putLE(&hdr[22], h, 4);
+    putLE(&hdr[26], 1, 2);
+    putLE(&hdr[28], 16, 2);
+    putLE(&hdr[30], 3, 4);
+    putLE(&hdr[34], stride * h, 4);
+    putLE(&hdr[38], 2835, 4);
+    putLE(&hdr[42], 2835, 4);
+    putLE(&hdr[54], 0xF800, 4);
+    putLE(&hdr[58], 0x07E0, 4);
+    putLE(&hdr[62], 0x001F, 4);
+    out.write(hdr, sizeof(hdr));
+    row = 0;
+  }
+
+  for (; (rows > 0) && (row < h); rows--, row++) {
+    /* BMP rows are stored bottom row first */
+    int16_t y = h - 1 - row;
+    for (int16_t x = 0; x < w;) {
+      int16_t n = w - x;
+      if (n > RA8875_LINEBUF_SIZE / 2)
+        n = RA8875_LINEBUF_SIZE / 2;
+      readPixels(x, y, n, 1, px);
+      for (int16_t i = 0; i < n; i++)
+        putLE(&buf[i * 2], px[i], 2);
+      out.write(buf, n * 2);
+      x += n;
+    }
+    memset(buf, 0, 4);
+    out.write(buf, stride - (uint32_t)w * 2);
+  }
+  return row;
+}
+
+/**************************************************************************/
+/*!
+      HW accelerated function to push a chunk of raw pixel data
+
+      @param num The number of pixels to push
+      @param p   The pixel color to use
+*/
+/**************************************************************************/
+void Adafruit_RA8875::pushPixels(uint32_t num, uint16_t p) {
+  sync();
+  beginBurst();
+  beginFrame(RA8875_DATAWRITE);
+  writePixelData(NULL, p, num);
+  endFrame();
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+      Sends pixel data in an open memory write cycle. The pixels are
+      expanded into a line buffer and sent with buffer-level SPI transfers,
+      which use the FIFO or DMA where the core supports it. In 8bpp mode
+      each pixel is converted to one RGB332 byte, dithered from the
+      position set by ditherStart() when p is not NULL.
+
+      @param p     An array of RGB565 pixels, or NULL to repeat color
+      @param color The RGB565 color to repeat when p is NULL
+      @param num   The number of pixels to send
+*/
+/**************************************************************************/
+void Adafruit_RA8875::writePixelData(const uint16_t* p, uint16_t color,
+                                     uint32_t num) {
+  uint8_t buf[RA8875_LINEBUF_SIZE];
+  uint8_t bpp = _bpp / 8;
+  uint8_t c8 = color332(color);
+
+  while (num) {
+    uint16_t n = RA8875_LINEBUF_SIZE / bpp;
+    if (num < n)
+      n = num;
+    num -= n;
+
+    /* Refill every chunk, the in-place transfer overwrites the buffer */
+    uint8_t* b = buf;
+    for (uint16_t i = 0; i < n; i++) {
+      if (bpp == 1) {
+        *b++ = p ? pixel332(*p++) : c8;
+        continue;
+      }
+      if (p)
+        color = *p++;
+      *b++ = color >> 8;
+      *b++ = color;
+    }
+
+#if defined(ESP32) || defined(ESP8266)
+    SPI.writeBytes(buf, n * bpp);
+#elif defined(TEENSYDUINO)
+    SPI.transfer(buf, NULL, n * bpp);
+#else
+    SPI.transfer(buf, n * bpp);
+#endif
+    RA8875_COUNT(bytes, n * bpp);
+  }
+}
+
+/**************************************************************************/
+/*!
+      Sets the position of the next pixel for the 8bpp ordered dither
+
+      @param x The 0-based x location of the first pixel
+      @param y The 0-based y location of the first pixel
+      @param w The number of pixels in each row, or the pixel count of a
+               write that stays on one row
+*/
+/**************************************************************************/
+void Adafruit_RA8875::ditherStart(int16_t x, int16_t y, uint32_t w) {
+  _ditherX = _ditherX0 = x;
+  _ditherX1 = (w <= (uint32_t)(0x7FFF - x)) ? x + w - 1 : 0x7FFF;
+  _ditherY = y;
+}
+
+/**************************************************************************/
+/*!
+      Converts the next pixel of a write to RGB332, applying the ordered
+      dither when enabled and moving to the following pixel
+
+      @param color The RGB565 color of the pixel
+
+      @return The RGB332 pixel value
+*/
+/**************************************************************************/
+uint8_t Adafruit_RA8875::pixel332(uint16_t color) {
+  if (!_dither)
+    return color332(color);
+
+  uint8_t t = bayer4[_ditherY & 3][_ditherX & 3];
+  if (_ditherX == _ditherX1) {
+    _ditherX = _ditherX0;
+    _ditherY++;
+  } else {
+    _ditherX++;
+  }
+
+  /* Add the threshold below the kept bits of each channel, then truncate */
+  uint8_t r = (color >> 11) + (t >> 2);
+  uint8_t g = ((color >> 5) & 0x3F) + (t >> 1);
+  uint8_t b = (color & 0x1F) + (t >> 1);
+  r = (r > 0x1F) ? 7 : r >> 2;
+  g = (g > 0x3F) ? 7 : g >> 3;
+  b = (b > 0x1F) ? 3 : b >> 3;
+  return (r << 5) | (g << 2) | b;
+}
+
+/**************************************************************************/
+/*!
+      Reads pixel data in an open memory read cycle, in line buffer sized
+      SPI transfers. 8bpp pixels are expanded to RGB565.
+
+      @param p   The buffer for the RGB565 pixels
+      @param num The number of pixels to read
+*/
+/**************************************************************************/
+void Adafruit_RA8875::readPixelData(uint16_t* p, uint32_t num) {
+  uint8_t buf[RA8875_LINEBUF_SIZE];
+  uint8_t bpp = _bpp / 8;
+
+  while (num) {
+    uint16_t n = RA8875_LINEBUF_SIZE / bpp;
+    if (num < n)
+      n = num;
+    num -= n;
+
+    memset(buf, 0, n * bpp);
+    SPI.transfer(buf, n * bpp);
+    RA8875_COUNT(bytes, n * bpp);
+
+    /* 16bpp pixels arrive low byte first */
+    uint8_t* b = buf;
+    for (uint16_t i = 0; i < n; i++) {
+      if (bpp == 1) {
+        uint8_t c = *b++;
+        uint8_t r = c >> 5, g = (c >> 2) & 0x07, bl = c & 0x03;
+        *p++ = ((r << 2 | r >> 1) << 11) | ((g << 3 | g) << 5) |
+               (bl << 3 | bl << 1 | bl >> 1);
+        continue;
+      }
+      *p++ = b[0] | (b[1] << 8);
+      b += 2;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    Fill the screen with the current color
+*/
+/**************************************************************************/
+void Adafruit_RA8875::fillRect(void) {
+  sync();
+  writeCommand(RA8875_DCR);
+  writeData(RA8875_DCR_LINESQUTRI_STOP | RA8875_DCR_DRAWSQUARE);
+  writeData(RA8875_DCR_LINESQUTRI_START | RA8875_DCR_FILL |
+            RA8875_DCR_DRAWSQUARE);
+
+  /* Let the next drawing call wait for the fill to finish */
+  _busyReg = RA8875_DCR;
+  _busyFlag = RA8875_DCR_LINESQUTRI_STATUS;
+}
+
+/**************************************************************************/
+/*!
+    Apply current rotation to a point, giving controller coordinates
+
+    @param x The x value, replaced by the rotated x value
+    @param y The y value, replaced by the rotated y value
+ */
+/**************************************************************************/
+void Adafruit_RA8875::applyRotation(int16_t& x, int16_t& y) {
+  /* Portrait memory is transposed, the panel scan direction does the rest */
+  if (_rotation & 1)
+    swap(x, y);
+
+  y += _voffset;
+}
+
+/**************************************************************************/
+/*!
+    Returns the memory write direction that runs left to right along a row
+    at the current rotation
+
+    @return One of the RA8875_MWCR0_* direction values
+ */
+/**************************************************************************/
+uint8_t Adafruit_RA8875::rotationDir(void) {
+  return (_rotation & 1) ? RA8875_MWCR0_TDLR : RA8875_MWCR0_LRTD;
+}
+
+/**************************************************************************/
+/*!
+    Map a pixel of a rectangle in memory order to its offset in the
+    rectangle at the current rotation
+
+    @param i  The column of the pixel in memory order
+    @param j  The row of the pixel in memory order
+    @param lx Set to the x offset of the pixel
+    @param ly Set to the y offset of the pixel
+ */
+/**************************************************************************/
+void Adafruit_RA8875::logicalOffset(int16_t i, int16_t j, int16_t& lx,
+                                    int16_t& ly) {
+  lx = (_rotation & 1) ? j : i;
+  ly = (_rotation & 1) ? i : j;
+}
+
+/**************************************************************************/
+/*!
+      Draws a single pixel at the specified location
+
+      @param x     The 0-based x location
+      @param y     The 0-base y location
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < _clipX0) || (y < _clipY0) || (x > _clipX1) || (y > _clipY1))
+    return;
+
+  sync();
+  ditherStart(x, y, 1);
+  applyRotation(x, y);
+
+  beginBurst();
+  writeReg16(RA8875_CURH0, x);
+  writeReg16(RA8875_CURV0, y);
+  writeCommand(RA8875_MRWC);
+  beginFrame(RA8875_DATAWRITE);
+  if (_bpp == 8) {
+    spiWrite(pixel332(color));
+  } else {
+    spiWrite(color >> 8);
+    spiWrite(color);
+  }
+  endFrame();
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+ Draws a series of pixels at the specified location without the overhead
+
+ @param p     An array of RGB565 color pixels
+ @param num   The number of the pixels to draw
+ @param x     The 0-based x location
+ @param y     The 0-base y location
+ */
+/**************************************************************************/
+void Adafruit_RA8875::drawPixels(uint16_t* p, uint32_t num, int16_t x,
+                                 int16_t y) {
+  sync();
+  ditherStart(x, y, num);
+  applyRotation(x, y);
+
+  beginBurst();
+  writeReg16(RA8875_CURH0, x);
+  writeReg16(RA8875_CURV0, y);
+
+  uint8_t dir = rotationDir();
+  writeReg(RA8875_MWCR0,
+           (readShadowReg(RA8875_MWCR0) & ~RA8875_MWCR0_DIRMASK) | dir);
+
+  writeCommand(RA8875_MRWC);
+  beginFrame(RA8875_DATAWRITE);
+  writePixelData(p, 0, num);
+  endFrame();
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+      Begins a batch of writePixel()/writeFastHLine() calls. The SPI bus
+      stays claimed until the matching endWrite().
+*/
+/**************************************************************************/
+void Adafruit_RA8875::startWrite(void) { beginBurst(); }
+
+/**************************************************************************/
+/*!
+      Draws a single pixel as part of a startWrite() batch. Pixels that
+      continue a run on the same row are buffered and sent later as one
+      auto-incrementing memory write.
+
+      @param x     The 0-based x location
+      @param y     The 0-base y location
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::writePixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < _clipX0) || (y < _clipY0) || (x > _clipX1) || (y > _clipY1))
+    return;
+
+  if (!_burstDepth) {
+    drawPixel(x, y, color);
+    return;
+  }
+
+  if (_runLen && ((y != _runY) || (x != _runX + _runLen) ||
+                  (_runLen == RA8875_RUN_SIZE)))
+    flushRun();
+
+  if (!_runLen) {
+    _runX = x;
+    _runY = y;
+  }
+  _run[_runLen++] = color;
+}
+
+/**************************************************************************/
+/*!
+      Draws a horizontal line as part of a startWrite() batch
+
+      @param x     The 0-based x location
+      @param y     The 0-base y location
+      @param w     The width of the line in pixels
+      @param color The RGB565 color to use when drawing the line
+*/
+/**************************************************************************/
+void Adafruit_RA8875::writeFastHLine(int16_t x, int16_t y, int16_t w,
+                                    uint16_t color) {
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+
+  /* Short spans join the pixel run, long ones use the HW fill */
+  if (w <= RA8875_RUN_SIZE) {
+    while (w--)
+      writePixel(x++, y, color);
+  } else {
+    fillRect(x, y, w, 1, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+      Ends a startWrite() batch, sending any buffered pixels
+*/
+/**************************************************************************/
+void Adafruit_RA8875::endWrite(void) {
+  flushRun();
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+      Sends the buffered writePixel() run as a single memory write
+*/
+/**************************************************************************/
+void Adafruit_RA8875::flushRun(void) {
+  uint8_t len = _runLen;
+  if (!len)
+    return;
+  _runLen = 0;
+  sync();
+
+  int16_t x = _runX, y = _runY;
+  applyRotation(x, y);
+  ditherStart(_runX, _runY, len);
+  beginBurst();
+  writeReg16(RA8875_CURH0, x);
+  writeReg16(RA8875_CURV0, y);
+  if (len > 1) {
+    uint8_t dir = rotationDir();
+    writeReg(RA8875_MWCR0,
+             (readShadowReg(RA8875_MWCR0) & ~RA8875_MWCR0_DIRMASK) | dir);
+  }
+
+  writeCommand(RA8875_MRWC);
+  beginFrame(RA8875_DATAWRITE);
+  writePixelData(_run, 0, len);
+  endFrame();
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+      Draws a PROGMEM-resident 16-bit RGB565 bitmap, streamed to the display
+      through the active window in a single memory write burst
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The RGB565 pixel data (in PROGMEM)
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawRGBBitmap(int16_t x, int16_t y,
+                                    const uint16_t bitmap[], int16_t w,
+                                    int16_t h) {
+  rgbBitmapHelper(x, y, bitmap, w, h, true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a RAM-resident 16-bit RGB565 bitmap, streamed to the display
+      through the active window in a single memory write burst
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The RGB565 pixel data (in RAM)
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                                    int16_t w, int16_t h) {
+  rgbBitmapHelper(x, y, bitmap, w, h, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a PROGMEM-resident 1-bit bitmap, only the set bits are drawn
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The bitmap, MSB first with rows padded to whole bytes
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+      @param color  The RGB565 color to use for set bits
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                 int16_t w, int16_t h, uint16_t color) {
+  monoBitmapHelper(x, y, bitmap, 0, (w + 7) & ~7, w, h, color, 0, true, true,
+                   false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a PROGMEM-resident 1-bit bitmap with a background color
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The bitmap, MSB first with rows padded to whole bytes
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+      @param color  The RGB565 color to use for set bits
+      @param bg     The RGB565 color to use for clear bits
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                 int16_t w, int16_t h, uint16_t color,
+                                 uint16_t bg) {
+  monoBitmapHelper(x, y, bitmap, 0, (w + 7) & ~7, w, h, color, bg, false, true,
+                   false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a RAM-resident 1-bit bitmap, only the set bits are drawn
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The bitmap, MSB first with rows padded to whole bytes
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+      @param color  The RGB565 color to use for set bits
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawBitmap(int16_t x, int16_t y, uint8_t* bitmap,
+                                 int16_t w, int16_t h, uint16_t color) {
+  monoBitmapHelper(x, y, bitmap, 0, (w + 7) & ~7, w, h, color, 0, true, false,
+                   false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a RAM-resident 1-bit bitmap with a background color
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The bitmap, MSB first with rows padded to whole bytes
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+      @param color  The RGB565 color to use for set bits
+      @param bg     The RGB565 color to use for clear bits
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawBitmap(int16_t x, int16_t y, uint8_t* bitmap,
+                                 int16_t w, int16_t h, uint16_t color,
+                                 uint16_t bg) {
+  monoBitmapHelper(x, y, bitmap, 0, (w + 7) & ~7, w, h, color, bg, false,
+                   false, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a PROGMEM-resident XBM (LSB first) bitmap, only the set bits
+      are drawn
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The XBM bitmap, LSB first with rows padded to whole bytes
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+      @param color  The RGB565 color to use for set bits
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                  int16_t w, int16_t h, uint16_t color) {
+  monoBitmapHelper(x, y, bitmap, 0, (w + 7) & ~7, w, h, color, 0, true, true,
+                   true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a RAM-resident 1-bit bitmap using BTE color expansion, which
+      sends one bit per pixel over SPI
+
+      @param x    The 0-based x location of the top-left corner
+      @param y    The 0-based y location of the top-left corner
+      @param w    The bitmap width in pixels
+      @param h    The bitmap height in pixels
+      @param bits The bitmap, MSB first with rows padded to whole bytes
+      @param fg   The RGB565 color to use for set bits
+      @param bg   The RGB565 color to use for clear bits
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawMonoBitmap(int16_t x, int16_t y, int16_t w,
+                                     int16_t h, const uint8_t* bits,
+                                     uint16_t fg, uint16_t bg) {
+  monoBitmapHelper(x, y, bits, 0, (w + 7) & ~7, w, h, fg, bg, false, false,
+                   false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a RAM-resident 1-bit bitmap using BTE color expansion, leaving
+      the pixels of clear bits untouched
+
+      @param x    The 0-based x location of the top-left corner
+      @param y    The 0-based y location of the top-left corner
+      @param w    The bitmap width in pixels
+      @param h    The bitmap height in pixels
+      @param bits The bitmap, MSB first with rows padded to whole bytes
+      @param fg   The RGB565 color to use for set bits
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawMonoBitmap(int16_t x, int16_t y, int16_t w,
+                                     int16_t h, const uint8_t* bits,
+                                     uint16_t fg) {
+  monoBitmapHelper(x, y, bits, 0, (w + 7) & ~7, w, h, fg, 0, true, false,
+                   false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a single character. Glyphs of custom GFX fonts at size 1 are
+      drawn with BTE color expansion, or as pixel runs when smaller than
+      RA8875_MONO_BTE_MIN pixels. Everything else is left to Adafruit_GFX.
+
+      @param x      The 0-based x location of the character origin
+      @param y      The 0-based y location of the character origin
+      @param c      The character
+      @param color  The RGB565 text color
+      @param bg     The RGB565 background color (classic font only)
+      @param size_x The horizontal magnification
+      @param size_y The vertical magnification
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawChar(int16_t x, int16_t y, unsigned char c,
+                               uint16_t color, uint16_t bg, uint8_t size_x,
+                               uint8_t size_y) {
+  if (!gfxFont || (size_x != 1) || (size_y != 1)) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+    return;
+  }
+
+  c -= (uint8_t)pgm_read_byte(&gfxFont->first);
+#ifdef __AVR__
+  GFXglyph* glyph = &((GFXglyph*)pgm_read_word(&gfxFont->glyph))[c];
+  const uint8_t* bitmap = (const uint8_t*)pgm_read_word(&gfxFont->bitmap);
+#else
+  GFXglyph* glyph = gfxFont->glyph + c;
+  const uint8_t* bitmap = gfxFont->bitmap;
+#endif
+
+  /* Glyph rows are packed back to back without padding */
+  uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+  uint8_t w = pgm_read_byte(&glyph->width);
+  uint8_t h = pgm_read_byte(&glyph->height);
+  int8_t xo = pgm_read_byte(&glyph->xOffset);
+  int8_t yo = pgm_read_byte(&glyph->yOffset);
+  monoBitmapHelper(x + xo, y + yo, bitmap, (uint32_t)bo * 8, w, w, h, color, 0,
+                   true, true, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a PROGMEM-resident 8-bit bitmap. As with Adafruit_GFX, each byte
+      is written as the pixel value without any color expansion.
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The 8-bit pixel data (in PROGMEM)
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawGrayscaleBitmap(int16_t x, int16_t y,
+                                          const uint8_t bitmap[], int16_t w,
+                                          int16_t h) {
+  grayBitmapHelper(x, y, bitmap, w, h, true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a RAM-resident 8-bit bitmap. As with Adafruit_GFX, each byte is
+      written as the pixel value without any color expansion.
+
+      @param x      The 0-based x location of the top-left corner
+      @param y      The 0-based y location of the top-left corner
+      @param bitmap The 8-bit pixel data (in RAM)
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawGrayscaleBitmap(int16_t x, int16_t y,
+                                          uint8_t* bitmap, int16_t w,
+                                          int16_t h) {
+  grayBitmapHelper(x, y, bitmap, w, h, false);
+}
+
+/**************************************************************************/
+/*!
+      Helper function for the RGB565 bitmap functions
+*/
+/**************************************************************************/
+void Adafruit_RA8875::rgbBitmapHelper(int16_t x, int16_t y,
+                                      const uint16_t* bitmap, int16_t w,
+                                      int16_t h, bool progmem) {
+  int16_t sx, sy, cw = w, ch = h;
+  if (!clipRect(x, y, cw, ch, sx, sy))
+    return;
+
+  streamBegin(x, y, cw, ch);
+  for (int16_t j = 0; j < ch; j++) {
+    const uint16_t* p = bitmap + (int32_t)(sy + j) * w + sx;
+    for (int16_t i = 0; i < cw; i++, p++)
+      streamPixel(progmem ? pgm_read_word(p) : *p);
+  }
+  streamEnd();
+}
+
+/**************************************************************************/
+/*!
+      Helper function for the 1-bit bitmap functions. The bits are sent to
+      the BTE, which expands them to colors on chip, so each pixel costs
+      one bit on the SPI bus.
+
+      @param x           The 0-based x location of the top-left corner
+      @param y           The 0-based y location of the top-left corner
+      @param bits        The bitmap data
+      @param bitOffset   The bit index of the first pixel in bits
+      @param stride      The distance between two rows, in bits
+      @param w           The bitmap width in pixels
+      @param h           The bitmap height in pixels
+      @param color       The RGB565 color to use for set bits
+      @param bg          The RGB565 color to use for clear bits
+      @param transparent Whether clear bits are left untouched
+      @param progmem     Whether bits is in PROGMEM
+      @param xbm         Whether the bits are LSB first (XBM)
+*/
+/**************************************************************************/
+void Adafruit_RA8875::monoBitmapHelper(int16_t x, int16_t y,
+                                       const uint8_t* bits, uint32_t bitOffset,
+                                       uint16_t stride, int16_t w, int16_t h,
+                                       uint16_t color, uint16_t bg,
+                                       bool transparent, bool progmem,
+                                       bool xbm) {
+  int16_t sx, sy, cw = w, ch = h;
+  if (!clipRect(x, y, cw, ch, sx, sy))
+    return;
+
+  /* Tiny transparent bitmaps, like the period of a GFX font, cost fewer
+     bus bytes as pixel runs than the BTE register setup does */
+  if (transparent && ((int32_t)cw * ch < RA8875_MONO_BTE_MIN)) {
+    monoRunsHelper(x, y, bits, bitOffset + (uint32_t)sy * stride + sx, stride,
+                   cw, ch, color, progmem, xbm);
+    return;
+  }
+
+  /* The engine fills the rectangle in memory order, which is columns at
+     rotations 1 and 3 */
+  int16_t pw = (_rotation & 1) ? ch : cw;
+  int16_t ph = (_rotation & 1) ? cw : ch;
+
+  sync();
+  beginBurst();
+  writeColor(0x63, color);
+  if (!transparent)
+    writeColor(0x60, bg);
+  bteStart(_layer, x, y, _layer, x, y, cw, ch,
+           transparent ? RA8875_BTE_EXPAND_TRANS : RA8875_BTE_EXPAND,
+           RA8875_BTE_EXPAND_MSB);
+  writeCommand(RA8875_MRWC);
+  beginFrame(RA8875_DATAWRITE);
+
+  /* Each row is sent MSB first and padded to whole bytes */
+  for (int16_t j = 0; j < ph; j++) {
+    uint32_t rowBit = bitOffset + (uint32_t)(sy + j) * stride + sx;
+    const uint8_t* p = bits + (rowBit >> 3);
+
+    if (!(_rotation & 1) && !xbm && !(rowBit & 7)) {
+      for (int16_t i = 0; i < cw; i += 8)
+        spiWrite(progmem ? pgm_read_byte(p++) : *p++);
+      continue;
+    }
+
+    for (int16_t i = 0; i < pw; i += 8) {
+      uint8_t out = 0;
+      for (uint8_t k = 0; (k < 8) && (i + k < pw); k++) {
+        int16_t lx, ly;
+        logicalOffset(i + k, j, lx, ly);
+        uint32_t bit = bitOffset + (uint32_t)(sy + ly) * stride + sx + lx;
+        if (monoBit(bits, bit, progmem, xbm))
+          out |= 0x80 >> k;
+      }
+      spiWrite(out);
+    }
+  }
+
+  endFrame();
+  endBurst();
+  waitEngine(RA8875_BECR0, RA8875_BECR0_ENABLE);
+}
+
+/**************************************************************************/
+/*!
+      Helper function for transparent 1-bit bitmaps below
+      RA8875_MONO_BTE_MIN pixels, which writes the runs of set bits along
+      each row. The cursor is left where a run ends, so only the cursor
+      bytes that differ are written for the next.
+
+      @param x         The 0-based x location of the top-left corner
+      @param y         The 0-based y location of the top-left corner
+      @param bits      The bitmap data
+      @param bitOffset Index of the bit for the top-left corner
+      @param stride    Bits per bitmap row
+      @param w         The width in pixels
+      @param h         The height in pixels
+      @param color     The RGB565 color to use for set bits
+      @param progmem   Whether bits is in PROGMEM
+      @param xbm       Whether bits are LSB first (XBM) instead of MSB first
+*/
+/**************************************************************************/
+void Adafruit_RA8875::monoRunsHelper(int16_t x, int16_t y, const uint8_t* bits,
+                                     uint32_t bitOffset, uint16_t stride,
+                                     int16_t w, int16_t h, uint16_t color,
+                                     bool progmem, bool xbm) {
+  /* Runs go along rows, which the rotation may turn into columns */
+  uint8_t dir = rotationDir();
+  int16_t dx = (dir == RA8875_MWCR0_LRTD) - (dir == RA8875_MWCR0_RLTD);
+  int16_t dy = (dir == RA8875_MWCR0_TDLR) - (dir == RA8875_MWCR0_DTLR);
+  int16_t curX = 0, curY = 0;
+  bool known = false;
+
+  sync();
+  beginBurst();
+  writeReg(RA8875_MWCR0,
+           (readShadowReg(RA8875_MWCR0) & ~RA8875_MWCR0_DIRMASK) | dir);
+  for (int16_t j = 0; j < h; j++) {
+    uint32_t row = bitOffset + (uint32_t)j * stride;
+    for (int16_t i = 0; i < w; i++) {
+      if (!monoBit(bits, row + i, progmem, xbm))
+        continue;
+      int16_t n = 1;
+      while ((i + n < w) && monoBit(bits, row + i + n, progmem, xbm))
+        n++;
+
+      int16_t cx = x + i, cy = y + j;
+      applyRotation(cx, cy);
+      if (!known || ((cx ^ curX) & 0x00FF))
+        writeReg(RA8875_CURH0, cx);
+      if (!known || ((cx ^ curX) & 0xFF00))
+        writeReg(RA8875_CURH1, cx >> 8);
+      if (!known || ((cy ^ curY) & 0x00FF))
+        writeReg(RA8875_CURV0, cy);
+      if (!known || ((cy ^ curY) & 0xFF00))
+        writeReg(RA8875_CURV1, cy >> 8);
+      writeCommand(RA8875_MRWC);
+      beginFrame(RA8875_DATAWRITE);
+      writePixelData(NULL, color, n);
+      endFrame();
+
+      /* A run that ends on the screen edge wraps the cursor */
+      curX = cx + dx * n;
+      curY = cy + dy * n;
+      known = (curX >= 0) && (curX < _width) && (curY >= 0) && (curY < _height);
+      i += n;
+    }
+  }
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+      Helper function for the 8-bit bitmap functions
+*/
+/**************************************************************************/
+void Adafruit_RA8875::grayBitmapHelper(int16_t x, int16_t y,
+                                       const uint8_t* bitmap, int16_t w,
+                                       int16_t h, bool progmem) {
+  int16_t sx, sy, cw = w, ch = h;
+  if (!clipRect(x, y, cw, ch, sx, sy))
+    return;
+
+  streamBegin(x, y, cw, ch);
+  for (int16_t j = 0; j < ch; j++) {
+    const uint8_t* p = bitmap + (int32_t)(sy + j) * w + sx;
+    for (int16_t i = 0; i < cw; i++, p++)
+      streamPixel(progmem ? pgm_read_byte(p) : *p);
+  }
+  streamEnd();
+}
+
+/**************************************************************************/
+/*!
+      Clip a rectangle to the clip rectangle, see setClipRect()
+
+      @param x  The x location, updated to the clipped left edge
+      @param y  The y location, updated to the clipped top edge
+      @param w  The width, updated to the clipped width
+      @param h  The height, updated to the clipped height
+      @param sx Set to the number of columns clipped off the left
+      @param sy Set to the number of rows clipped off the top
+
+      @return True if any part of the rectangle is visible
+*/
+/**************************************************************************/
+bool Adafruit_RA8875::clipRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h,
+                               int16_t& sx, int16_t& sy) {
+  sx = sy = 0;
+  if (x < _clipX0) {
+    sx = _clipX0 - x;
+    w -= sx;
+    x = _clipX0;
+  }
+  if (y < _clipY0) {
+    sy = _clipY0 - y;
+    h -= sy;
+    y = _clipY0;
+  }
+  if ((int32_t)x + w > (int32_t)_clipX1 + 1)
+    w = _clipX1 + 1 - x;
+  if ((int32_t)y + h > (int32_t)_clipY1 + 1)
+    h = _clipY1 + 1 - y;
+  return (w > 0) && (h > 0);
+}
+
+/**************************************************************************/
+/*!
+      Start streaming pixels into a rectangle. The active window is set to
+      the rectangle and the write direction to match the rotation, so the
+      controller wraps rows by itself and all pixels go out in one memory
+      write burst. Send the pixels with streamPixel() and finish with
+      streamEnd(). A read stream uses the read cursor instead, fetch the
+      pixels with readPixelData().
+
+      @param x    The 0-based x location of the top-left corner (unclipped)
+      @param y    The 0-based y location of the top-left corner (unclipped)
+      @param w    The rectangle width, the rectangle must be on screen
+      @param h    The rectangle height, the rectangle must be on screen
+      @param read Whether to read the rectangle instead of writing it
+
+*/
+/**************************************************************************/
+void Adafruit_RA8875::streamBegin(int16_t x, int16_t y, int16_t w, int16_t h,
+                                  bool read) {
+  int16_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+  applyRotation(x0, y0);
+  applyRotation(x1, y1);
+  if (x0 > x1)
+    swap(x0, x1);
+  if (y0 > y1)
+    swap(y0, y1);
+
+  // Rows run along the write direction of the rotation, down a memory
+  // column at rotations 1 and 3
+  uint8_t dir = rotationDir();
+
+  sync();
+  ditherStart(x, y, w);
+  beginBurst();
+  setActiveWindow(x0, y0, x1, y1);
+  if (read) {
+    writeReg16(RA8875_RCURH0, x0);
+    writeReg16(RA8875_RCURV0, y0);
+    writeReg(RA8875_MRCD, dir >> 2);
+    writeCommand(RA8875_MRWC);
+    beginFrame(RA8875_DATAREAD);
+    spiWrite(0); /* The first read after MRWC is a dummy */
+    return;
+  }
+  writeReg16(RA8875_CURH0, x0);
+  writeReg16(RA8875_CURV0, y0);
+  writeReg(RA8875_MWCR0,
+           (readShadowReg(RA8875_MWCR0) & ~RA8875_MWCR0_DIRMASK) | dir);
+  writeCommand(RA8875_MRWC);
+  beginFrame(RA8875_DATAWRITE);
+}
+
+/**************************************************************************/
+/*!
+      Send one pixel of a stream started with streamBegin()
+
+      @param color The RGB565 color of the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::streamPixel(uint16_t color) {
+  if (_bpp == 8) {
+    spiWrite(pixel332(color));
+    return;
+  }
+  spiWrite(color >> 8);
+  spiWrite(color);
+}
+
+/**************************************************************************/
+/*!
+      Finish a pixel stream and restore the full screen active window
+*/
+/**************************************************************************/
+void Adafruit_RA8875::streamEnd(void) {
+  endFrame();
+  resetActiveWindow();
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+      Set the active window, in controller coordinates
+
+      @param x0 The left edge
+      @param y0 The top edge
+      @param x1 The right edge
+      @param y1 The bottom edge
+*/
+/**************************************************************************/
+void Adafruit_RA8875::setActiveWindow(int16_t x0, int16_t y0, int16_t x1,
+                                      int16_t y1) {
+  beginBurst();
+  writeReg16(RA8875_HSAW0, x0);
+  writeReg16(RA8875_VSAW0, y0);
+  writeReg16(RA8875_HEAW0, x1);
+  writeReg16(RA8875_VEAW0, y1);
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+      Restore the active window to the clip rectangle
+*/
+/**************************************************************************/
+void Adafruit_RA8875::resetActiveWindow(void) {
+  int16_t x0 = _clipX0, y0 = _clipY0, x1 = _clipX1, y1 = _clipY1;
+  applyRotation(x0, y0);
+  applyRotation(x1, y1);
+  if (x0 > x1)
+    swap(x0, x1);
+  if (y0 > y1)
+    swap(y0, y1);
+  setActiveWindow(x0, y0, x1, y1);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated line on the display
+
+      @param x0    The 0-based starting x location
+      @param y0    The 0-base starting y location
+      @param x1    The 0-based ending x location
+      @param y1    The 0-base ending y location
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                               uint16_t color) {
+  sync();
+  applyRotation(x0, y0);
+  applyRotation(x1, y1);
+
+  beginBurst();
+  /* Set X */
+  writeReg16(0x91, x0);
+
+  /* Set Y */
+  writeReg16(0x93, y0);
+
+  /* Set X1 */
+  writeReg16(0x95, x1);
+
+  /* Set Y1 */
+  writeReg16(0x97, y1);
+
+  /* Set Color */
+  writeColor(0x63, color);
+
+  /* Draw! */
+  writeCommand(RA8875_DCR);
+  writeData(0x80);
+  endBurst();
+
+  /* Wait for the command to finish */
+  waitEngine(RA8875_DCR, RA8875_DCR_LINESQUTRI_STATUS);
+}
+
+/**************************************************************************/
+/*!
+    Draw a vertical line
+
+    @param x The X position
+    @param y The Y position
+    @param h Height
+    @param color The color
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                    uint16_t color) {
+  drawLine(x, y, x, y + h, color);
+}
+
+/**************************************************************************/
+/*!
+     Draw a horizontal line
+
+     @param x The X position
+     @param y The Y position
+     @param w Width
+     @param color The color
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                    uint16_t color) {
+  drawLine(x, y, x + w, y, color);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated rectangle on the display
+
+      @param x     The 0-based x location of the top-right corner
+      @param y     The 0-based y location of the top-right corner
+      @param w     The rectangle width
+      @param h     The rectangle height
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color) {
+  rectHelper(x, y, x + w - 1, y + h - 1, color, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated filled rectangle on the display
+
+      @param x     The 0-based x location of the top-right corner
+      @param y     The 0-based y location of the top-right corner
+      @param w     The rectangle width
+      @param h     The rectangle height
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color) {
+  rectHelper(x, y, x + w - 1, y + h - 1, color, true);
+}
+
+/**************************************************************************/
+/*!
+      Fills the screen with the spefied RGB565 color
+
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::fillScreen(uint16_t color) {
+  rectHelper(0, 0, width() - 1, height() - 1, color, true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated circle on the display
+
+      @param x     The 0-based x location of the center of the circle
+      @param y     The 0-based y location of the center of the circle
+      @param r     The circle's radius
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawCircle(int16_t x, int16_t y, int16_t r,
+                                 uint16_t color) {
+  circleHelper(x, y, r, color, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated filled circle on the display
+
+      @param x     The 0-based x location of the center of the circle
+      @param y     The 0-based y location of the center of the circle
+      @param r     The circle's radius
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::fillCircle(int16_t x, int16_t y, int16_t r,
+                                 uint16_t color) {
+  circleHelper(x, y, r, color, true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated triangle on the display
+
+      @param x0    The 0-based x location of point 0 on the triangle
+      @param y0    The 0-based y location of point 0 on the triangle
+      @param x1    The 0-based x location of point 1 on the triangle
+      @param y1    The 0-based y location of point 1 on the triangle
+      @param x2    The 0-based x location of point 2 on the triangle
+      @param y2    The 0-based y location of point 2 on the triangle
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                   int16_t y1, int16_t x2, int16_t y2,
+                                   uint16_t color) {
+  triangleHelper(x0, y0, x1, y1, x2, y2, color, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated filled triangle on the display
+
+      @param x0    The 0-based x location of point 0 on the triangle
+      @param y0    The 0-based y location of point 0 on the triangle
+      @param x1    The 0-based x location of point 1 on the triangle
+      @param y1    The 0-based y location of point 1 on the triangle
+      @param x2    The 0-based x location of point 2 on the triangle
+      @param y2    The 0-based y location of point 2 on the triangle
+      @param color The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                   int16_t y1, int16_t x2, int16_t y2,
+                                   uint16_t color) {
+  triangleHelper(x0, y0, x1, y1, x2, y2, color, true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated ellipse on the display
+
+      @param xCenter   The 0-based x location of the ellipse's center
+      @param yCenter   The 0-based y location of the ellipse's center
+      @param longAxis  The size in pixels of the ellipse's long axis
+      @param shortAxis The size in pixels of the ellipse's short axis
+      @param color     The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawEllipse(int16_t xCenter, int16_t yCenter,
+                                  int16_t longAxis, int16_t shortAxis,
+                                  uint16_t color) {
+  ellipseHelper(xCenter, yCenter, longAxis, shortAxis, color, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated filled ellipse on the display
+
+      @param xCenter   The 0-based x location of the ellipse's center
+      @param yCenter   The 0-based y location of the ellipse's center
+      @param longAxis  The size in pixels of the ellipse's long axis
+      @param shortAxis The size in pixels of the ellipse's short axis
+      @param color     The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::fillEllipse(int16_t xCenter, int16_t yCenter,
+                                  int16_t longAxis, int16_t shortAxis,
+                                  uint16_t color) {
+  ellipseHelper(xCenter, yCenter, longAxis, shortAxis, color, true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated curve on the display
+
+      @param xCenter   The 0-based x location of the ellipse's center
+      @param yCenter   The 0-based y location of the ellipse's center
+      @param longAxis  The size in pixels of the ellipse's long axis
+      @param shortAxis The size in pixels of the ellipse's short axis
+      @param curvePart The corner to draw, where in clock-wise motion:
+                            0 = 180-270°
+                            1 = 270-0°
+                            2 = 0-90°
+                            3 = 90-180°
+      @param color     The RGB565 color to use when drawing the pixel
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawCurve(int16_t xCenter, int16_t yCenter,
+                                int16_t longAxis, int16_t shortAxis,
+                                uint8_t curvePart, uint16_t color) {
+  curveHelper(xCenter, yCenter, longAxis, shortAxis, curvePart, color, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated filled curve on the display
 
       @param xCenter   The 0-based x location of the ellipse's center
       @param yCenter   The 0-based y location of the ellipse's center
@@ -992,458 +2395,1188 @@ void Adafruit_RA8875::drawCurve(int16_t xCenter, int16_t yCenter,
       @param color     The RGB565 color to use when drawing the pixel
 */
 /**************************************************************************/
-void Adafruit_RA8875::fillCurve(int16_t xCenter, int16_t yCenter,
-                                int16_t longAxis, int16_t shortAxis,
-                                uint8_t curvePart, uint16_t color) {
-  curveHelper(xCenter, yCenter, longAxis, shortAxis, curvePart, color, true);
+void Adafruit_RA8875::fillCurve(int16_t xCenter, int16_t yCenter,
+                                int16_t longAxis, int16_t shortAxis,
+                                uint8_t curvePart, uint16_t color) {
+  curveHelper(xCenter, yCenter, longAxis, shortAxis, curvePart, color, true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated rounded rectangle on the display
+
+      @param x   The 0-based x location of the rectangle's upper left corner
+      @param y   The 0-based y location of the rectangle's upper left corner
+      @param w   The size in pixels of the rectangle's width
+      @param h   The size in pixels of the rectangle's height
+      @param r   The radius of the curves in the corners of the rectangle
+      @param color  The RGB565 color to use when drawing the pixel
+ */
+/**************************************************************************/
+void Adafruit_RA8875::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                    int16_t r, uint16_t color) {
+  roundRectHelper(x, y, x + w, y + h, r, color, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a HW accelerated filled rounded rectangle on the display
+
+      @param x   The 0-based x location of the rectangle's upper left corner
+      @param y   The 0-based y location of the rectangle's upper left corner
+      @param w   The size in pixels of the rectangle's width
+      @param h   The size in pixels of the rectangle's height
+      @param r   The radius of the curves in the corners of the rectangle
+      @param color  The RGB565 color to use when drawing the pixel
+ */
+/**************************************************************************/
+void Adafruit_RA8875::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                    int16_t r, uint16_t color) {
+  roundRectHelper(x, y, x + w, y + h, r, color, true);
+}
+
+/**************************************************************************/
+/*!
+      Helper function for higher level circle drawing code
+*/
+/**************************************************************************/
+void Adafruit_RA8875::circleHelper(int16_t x, int16_t y, int16_t r,
+                                   uint16_t color, bool filled) {
+  sync();
+  applyRotation(x, y);
+
+  beginBurst();
+  /* Set X */
+  writeReg16(0x99, x);
+
+  /* Set Y */
+  writeReg16(0x9b, y);
+
+  /* Set Radius */
+  writeReg(0x9d, r);
+
+  /* Set Color */
+  writeColor(0x63, color);
+
+  /* Draw! */
+  writeCommand(RA8875_DCR);
+  if (filled) {
+    writeData(RA8875_DCR_CIRCLE_START | RA8875_DCR_FILL);
+  } else {
+    writeData(RA8875_DCR_CIRCLE_START | RA8875_DCR_NOFILL);
+  }
+  endBurst();
+
+  /* Wait for the command to finish */
+  waitEngine(RA8875_DCR, RA8875_DCR_CIRCLE_STATUS);
+}
+
+/**************************************************************************/
+/*!
+      Helper function for higher level rectangle drawing code
+*/
+/**************************************************************************/
+void Adafruit_RA8875::rectHelper(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color, bool filled) {
+  sync();
+  applyRotation(x, y);
+  applyRotation(w, h);
+
+  beginBurst();
+  /* Set X */
+  writeReg16(0x91, x);
+
+  /* Set Y */
+  writeReg16(0x93, y);
+
+  /* Set X1 */
+  writeReg16(0x95, w);
+
+  /* Set Y1 */
+  writeReg16(0x97, h);
+
+  /* Set Color */
+  writeColor(0x63, color);
+
+  /* Draw! */
+  writeCommand(RA8875_DCR);
+  if (filled) {
+    writeData(0xB0);
+  } else {
+    writeData(0x90);
+  }
+  endBurst();
+
+  /* Wait for the command to finish */
+  waitEngine(RA8875_DCR, RA8875_DCR_LINESQUTRI_STATUS);
+}
+
+/**************************************************************************/
+/*!
+      Helper function for higher level triangle drawing code
+*/
+/**************************************************************************/
+void Adafruit_RA8875::triangleHelper(int16_t x0, int16_t y0, int16_t x1,
+                                     int16_t y1, int16_t x2, int16_t y2,
+                                     uint16_t color, bool filled) {
+  sync();
+  applyRotation(x0, y0);
+  applyRotation(x1, y1);
+  applyRotation(x2, y2);
+
+  beginBurst();
+  /* Set Point 0 */
+  writeReg16(0x91, x0);
+  writeReg16(0x93, y0);
+
+  /* Set Point 1 */
+  writeReg16(0x95, x1);
+  writeReg16(0x97, y1);
+
+  /* Set Point 2 */
+  writeReg16(0xA9, x2);
+  writeReg16(0xAB, y2);
+
+  /* Set Color */
+  writeColor(0x63, color);
+
+  /* Draw! */
+  writeCommand(RA8875_DCR);
+  if (filled) {
+    writeData(0xA1);
+  } else {
+    writeData(0x81);
+  }
+  endBurst();
+
+  /* Wait for the command to finish */
+  waitEngine(RA8875_DCR, RA8875_DCR_LINESQUTRI_STATUS);
+}
+
+/**************************************************************************/
+/*!
+      Helper function for higher level ellipse drawing code
+*/
+/**************************************************************************/
+void Adafruit_RA8875::ellipseHelper(int16_t xCenter, int16_t yCenter,
+                                    int16_t longAxis, int16_t shortAxis,
+                                    uint16_t color, bool filled) {
+  sync();
+  applyRotation(xCenter, yCenter);
+  if (_rotation & 1)
+    swap(longAxis, shortAxis);
+
+  beginBurst();
+  /* Set Center Point */
+  writeReg16(0xA5, xCenter);
+  writeReg16(0xA7, yCenter);
+
+  /* Set Long and Short Axis */
+  writeReg16(0xA1, longAxis);
+  writeReg16(0xA3, shortAxis);
+
+  /* Set Color */
+  writeColor(0x63, color);
+
+  /* Draw! */
+  writeCommand(0xA0);
+  if (filled) {
+    writeData(0xC0);
+  } else {
+    writeData(0x80);
+  }
+  endBurst();
+
+  /* Wait for the command to finish */
+  waitEngine(RA8875_ELLIPSE, RA8875_ELLIPSE_STATUS);
+}
+
+/**************************************************************************/
+/*!
+      Helper function for higher level curve drawing code
+*/
+/**************************************************************************/
+void Adafruit_RA8875::curveHelper(int16_t xCenter, int16_t yCenter,
+                                  int16_t longAxis, int16_t shortAxis,
+                                  uint8_t curvePart, uint16_t color,
+                                  bool filled) {
+  sync();
+  applyRotation(xCenter, yCenter);
+  /* Transposing swaps the top-right and bottom-left quarters */
+  if (_rotation & 1) {
+    curvePart = (6 - curvePart) % 4;
+    swap(longAxis, shortAxis);
+  }
+
+  beginBurst();
+  /* Set Center Point */
+  writeReg16(0xA5, xCenter);
+  writeReg16(0xA7, yCenter);
+
+  /* Set Long and Short Axis */
+  writeReg16(0xA1, longAxis);
+  writeReg16(0xA3, shortAxis);
+
+  /* Set Color */
+  writeColor(0x63, color);
+
+  /* Draw! */
+  writeCommand(0xA0);
+  if (filled) {
+    writeData(0xD0 | (curvePart & 0x03));
+  } else {
+    writeData(0x90 | (curvePart & 0x03));
+  }
+  endBurst();
+
+  /* Wait for the command to finish */
+  waitEngine(RA8875_ELLIPSE, RA8875_ELLIPSE_STATUS);
+}
+
+/**************************************************************************/
+/*!
+      Helper function for higher level rounded rectangle drawing code
+ */
+/**************************************************************************/
+void Adafruit_RA8875::roundRectHelper(int16_t x, int16_t y, int16_t w,
+                                      int16_t h, int16_t r, uint16_t color,
+                                      bool filled) {
+  sync();
+  applyRotation(x, y);
+  applyRotation(w, h);
+  if (x > w)
+    swap(x, w);
+  if (y > h)
+    swap(y, h);
+
+  beginBurst();
+  /* Set X */
+  writeReg16(0x91, x);
+
+  /* Set Y */
+  writeReg16(0x93, y);
+
+  /* Set X1 */
+  writeReg16(0x95, w);
+
+  /* Set Y1 */
+  writeReg16(0x97, h);
+
+  writeReg16(0xA1, r);
+  writeReg16(0xA3, r);
+
+  /* Set Color */
+  writeColor(0x63, color);
+
+  /* Draw! */
+  writeCommand(RA8875_ELLIPSE);
+  if (filled) {
+    writeData(0xE0);
+  } else {
+    writeData(0xA0);
+  }
+  endBurst();
+
+  /* Wait for the command to finish */
+  waitEngine(RA8875_ELLIPSE, RA8875_DCR_LINESQUTRI_STATUS);
+}
+/**************************************************************************/
+/*!
+      Set the scroll window
+
+      @param x  X position of the scroll window
+      @param y  Y position of the scroll window
+      @param w  Width of the Scroll Window
+      @param h  Height of the Scroll window
+      @param mode Layer to Scroll
+
+ */
+/**************************************************************************/
+void Adafruit_RA8875::setScrollWindow(int16_t x, int16_t y, int16_t w,
+                                      int16_t h, uint8_t mode) {
+  beginBurst();
+  // Horizontal Start point of Scroll Window
+  writeReg16(0x38, x);
+
+  // Vertical Start Point of Scroll Window
+  writeReg16(0x3a, y);
+
+  // Horizontal End Point of Scroll Window
+  writeReg16(0x3c, x + w);
+
+  // Vertical End Point of Scroll Window
+  writeReg16(0x3e, y + h);
+
+  // Scroll function setting, keeping the layer display mode
+  writeReg(RA8875_LTPR0,
+           (readShadowReg(RA8875_LTPR0) & ~RA8875_LTPR0_SCROLLMASK) | mode);
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+    Scroll in the X direction
+
+    @param dist The distance to scroll
+
+ */
+/**************************************************************************/
+void Adafruit_RA8875::scrollX(int16_t dist) {
+  writeReg16(0x24, dist);
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated rounded rectangle on the display
+     Scroll in the Y direction
+
+     @param dist The distance to scroll
 
-      @param x   The 0-based x location of the rectangle's upper left corner
-      @param y   The 0-based y location of the rectangle's upper left corner
-      @param w   The size in pixels of the rectangle's width
-      @param h   The size in pixels of the rectangle's height
-      @param r   The radius of the curves in the corners of the rectangle
-      @param color  The RGB565 color to use when drawing the pixel
  */
 /**************************************************************************/
-void Adafruit_RA8875::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
-                                    int16_t r, uint16_t color) {
-  roundRectHelper(x, y, x + w, y + h, r, color, false);
+void Adafruit_RA8875::scrollY(int16_t dist) {
+  writeReg16(0x26, dist);
 }
 
 /**************************************************************************/
 /*!
-      Draws a HW accelerated filled rounded rectangle on the display
+      Enables or disables the second display layer. Two layers fit in
+      display memory at 480x272 and smaller, the 800x480 panel needs 8 bits
+      per pixel (see setColorDepth()) for a second layer. Disabling the
+      second layer also ends double buffering.
 
-      @param x   The 0-based x location of the rectangle's upper left corner
-      @param y   The 0-based y location of the rectangle's upper left corner
-      @param w   The size in pixels of the rectangle's width
-      @param h   The size in pixels of the rectangle's height
-      @param r   The radius of the curves in the corners of the rectangle
-      @param color  The RGB565 color to use when drawing the pixel
- */
+      @param on Whether to use two layers
+
+      @return False if the second layer does not fit in display memory
+*/
 /**************************************************************************/
-void Adafruit_RA8875::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
-                                    int16_t r, uint16_t color) {
-  roundRectHelper(x, y, x + w, y + h, r, color, true);
+boolean Adafruit_RA8875::enableLayers(boolean on) {
+  if (on && ((uint32_t)_width * _height * (_bpp / 8) * 2 > RA8875_DISPLAY_RAM))
+    return false;
+
+  sync();
+  uint8_t dpcr = readShadowReg(RA8875_DPCR) & ~RA8875_DPCR_LAYERS2;
+  writeReg(RA8875_DPCR, dpcr | (on ? RA8875_DPCR_LAYERS2 : 0));
+  if (!on) {
+    _doubleBuffer = false;
+    setLayer(RA8875_LAYER1);
+    setDisplayLayer(RA8875_LAYER1);
+  }
+  return true;
 }
 
 /**************************************************************************/
 /*!
-      Helper function for higher level circle drawing code
+      Selects the layer that drawing calls write to
+
+      @param layer RA8875_LAYER1 or RA8875_LAYER2
 */
 /**************************************************************************/
-void Adafruit_RA8875::circleHelper(int16_t x, int16_t y, int16_t r,
-                                   uint16_t color, bool filled) {
-  x = applyRotationX(x);
-  y = applyRotationY(y);
+void Adafruit_RA8875::setLayer(uint8_t layer) {
+  sync();
+  _layer = layer & RA8875_MWCR1_LAYER;
+  writeReg(RA8875_MWCR1,
+           (readShadowReg(RA8875_MWCR1) & ~RA8875_MWCR1_LAYER) | _layer);
+}
 
-  /* Set X */
-  writeCommand(0x99);
-  writeData(x);
-  writeCommand(0x9a);
-  writeData(x >> 8);
+/**************************************************************************/
+/*!
+      Returns the layer that drawing calls write to
 
-  /* Set Y */
-  writeCommand(0x9b);
-  writeData(y);
-  writeCommand(0x9c);
-  writeData(y >> 8);
+      @return RA8875_LAYER1 or RA8875_LAYER2
+*/
+/**************************************************************************/
+uint8_t Adafruit_RA8875::getLayer(void) { return _layer; }
 
-  /* Set Radius */
-  writeCommand(0x9d);
-  writeData(r);
+/**************************************************************************/
+/*!
+      Selects the layer that is shown on the display
 
-  /* Set Color */
-  writeCommand(0x63);
-  writeData((color & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((color & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((color & 0x001f));
+      @param layer RA8875_LAYER1 or RA8875_LAYER2
+*/
+/**************************************************************************/
+void Adafruit_RA8875::setDisplayLayer(uint8_t layer) {
+  sync();
+  _displayLayer = layer & 1;
+  writeReg(RA8875_LTPR0,
+           (readShadowReg(RA8875_LTPR0) & ~RA8875_LTPR0_DISPMASK) |
+               (_displayLayer ? RA8875_LTPR0_LAYER2 : RA8875_LTPR0_LAYER1));
+}
 
-  /* Draw! */
-  writeCommand(RA8875_DCR);
-  if (filled) {
-    writeData(RA8875_DCR_CIRCLE_START | RA8875_DCR_FILL);
-  } else {
-    writeData(RA8875_DCR_CIRCLE_START | RA8875_DCR_NOFILL);
-  }
+/**************************************************************************/
+/*!
+      Returns the layer that is shown on the display
 
-  /* Wait for the command to finish */
-  waitPoll(RA8875_DCR, RA8875_DCR_CIRCLE_STATUS);
+      @return RA8875_LAYER1 or RA8875_LAYER2
+*/
+/**************************************************************************/
+uint8_t Adafruit_RA8875::getDisplayLayer(void) { return _displayLayer; }
+
+/**************************************************************************/
+/*!
+      Enables or disables double buffering. The two layers are used as
+      front and back buffers: drawing goes to the hidden back buffer and
+      present() shows it. Both layers take turns as the back buffer, so
+      no layer is left for the asset cache.
+
+      @param on Whether to double buffer
+
+      @return False if two layers do not fit in display memory, or if an
+              asset cache area is set
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::setDoubleBuffer(boolean on) {
+  if (on && (_cacheW > 0) && (_cacheH > 0))
+    return false;
+  if (!enableLayers(on))
+    return false;
+
+  _doubleBuffer = on;
+  if (on) {
+    setDisplayLayer(RA8875_LAYER1);
+    setLayer(RA8875_LAYER2);
+  }
+  return true;
 }
 
 /**************************************************************************/
 /*!
-      Helper function for higher level rectangle drawing code
+      Use the panel VSYNC signal to flip buffers during vertical blank
+
+      @param pin The GPIO connected to VSYNC (active low), or -1 to flip
+                 without waiting
 */
 /**************************************************************************/
-void Adafruit_RA8875::rectHelper(int16_t x, int16_t y, int16_t w, int16_t h,
-                                 uint16_t color, bool filled) {
-  x = applyRotationX(x);
-  y = applyRotationY(y);
-  w = applyRotationX(w);
-  h = applyRotationY(h);
+void Adafruit_RA8875::setVsyncPin(int8_t pin) {
+  _vsyncPin = pin;
+  if (pin >= 0)
+    pinMode(pin, INPUT);
+}
 
-  /* Set X */
-  writeCommand(0x91);
-  writeData(x);
-  writeCommand(0x92);
-  writeData(x >> 8);
+/**************************************************************************/
+/*!
+      Shows the back buffer and makes the old front buffer the new back
+      buffer. Waits for pending drawing, and for the start of vertical
+      blank when a VSYNC pin was set, so the flip does not tear. If VSYNC
+      does not change within the poll timeout the flip happens anyway and
+      timedOut() reports it. Does nothing unless double buffering is on.
+
+      @param preserve Whether to copy the new front buffer into the new
+                      back buffer (on chip), for incremental redraws
+*/
+/**************************************************************************/
+void Adafruit_RA8875::present(boolean preserve) {
+  if (!_doubleBuffer)
+    return;
 
-  /* Set Y */
-  writeCommand(0x93);
-  writeData(y);
-  writeCommand(0x94);
-  writeData(y >> 8);
+  uint8_t back = _layer;
+  sync();
+  if (_vsyncPin >= 0) {
+    /* Let a pulse in progress pass, then catch the next one starting */
+    if (vsyncHelper(LOW))
+      vsyncHelper(HIGH);
+  }
+  setDisplayLayer(back);
+  setLayer(back ^ 1);
+
+  /* The whole frame is copied, whatever the clip rectangle */
+  if (preserve) {
+    bteStart(back, 0, 0, back ^ 1, 0, 0, width(), height(),
+             RA8875_BTE_MOVE_POS, RA8875_BTE_ROP_S);
+    waitEngine(RA8875_BECR0, RA8875_BECR0_ENABLE);
+  }
+}
 
-  /* Set X1 */
-  writeCommand(0x95);
-  writeData(w);
-  writeCommand(0x96);
-  writeData((w) >> 8);
+/**************************************************************************/
+/*!
+      Waits for the VSYNC pin to leave a level. Polls without a backoff, as
+      a pulse can be only a few lines long.
 
-  /* Set Y1 */
-  writeCommand(0x97);
-  writeData(h);
-  writeCommand(0x98);
-  writeData((h) >> 8);
+      @param level The level to wait out, LOW or HIGH
 
-  /* Set Color */
-  writeCommand(0x63);
-  writeData((color & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((color & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((color & 0x001f));
+      @return False if the poll timeout expired first
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::vsyncHelper(uint8_t level) {
+  unsigned long start = millis();
+  uint16_t backoff = 0;
 
-  /* Draw! */
-  writeCommand(RA8875_DCR);
-  if (filled) {
-    writeData(0xB0);
-  } else {
-    writeData(0x90);
+  while (digitalRead(_vsyncPin) == level) {
+    if (!pollDelay(start, backoff)) {
+      _timedOut = true;
+      return false;
+    }
   }
+  return true;
+}
 
-  /* Wait for the command to finish */
-  waitPoll(RA8875_DCR, RA8875_DCR_LINESQUTRI_STATUS);
+/**************************************************************************/
+/*!
+      Copy a rectangle within the current layer using the Block Transfer
+      Engine. No pixel data crosses the SPI bus.
+
+      @param sx  The 0-based x location of the source rectangle
+      @param sy  The 0-based y location of the source rectangle
+      @param dx  The 0-based x location of the destination rectangle
+      @param dy  The 0-based y location of the destination rectangle
+      @param w   The rectangle width
+      @param h   The rectangle height
+      @param dir The copy direction, RA8875_BTE_AUTO picks the one that is
+                 safe for overlapping rectangles
+*/
+/**************************************************************************/
+void Adafruit_RA8875::bteMove(int16_t sx, int16_t sy, int16_t dx, int16_t dy,
+                              int16_t w, int16_t h, enum RA8875bteDir dir) {
+  bteMove(_layer, sx, sy, _layer, dx, dy, w, h, dir);
 }
 
 /**************************************************************************/
 /*!
-      Helper function for higher level triangle drawing code
+      Copy a rectangle, possibly between layers, using the Block Transfer
+      Engine. With setAsync() the call returns as soon as the copy has
+      started; the next drawing call (or sync()) waits for it, using the
+      INT pin when one was set with setIntPin().
+
+      @param srcLayer The source layer, RA8875_LAYER1 or RA8875_LAYER2
+      @param sx       The 0-based x location of the source rectangle
+      @param sy       The 0-based y location of the source rectangle
+      @param dstLayer The destination layer, RA8875_LAYER1 or RA8875_LAYER2
+      @param dx       The 0-based x location of the destination rectangle
+      @param dy       The 0-based y location of the destination rectangle
+      @param w        The rectangle width
+      @param h        The rectangle height
+      @param dir      The copy direction relative to the current rotation,
+                      RA8875_BTE_AUTO picks the one that is safe for
+                      overlapping rectangles. Rotations 1 and 3 always use
+                      the safe direction.
 */
 /**************************************************************************/
-void Adafruit_RA8875::triangleHelper(int16_t x0, int16_t y0, int16_t x1,
-                                     int16_t y1, int16_t x2, int16_t y2,
-                                     uint16_t color, bool filled) {
-  x0 = applyRotationX(x0);
-  y0 = applyRotationY(y0);
-  x1 = applyRotationX(x1);
-  y1 = applyRotationY(y1);
-  x2 = applyRotationX(x2);
-  y2 = applyRotationY(y2);
+void Adafruit_RA8875::bteMove(uint8_t srcLayer, int16_t sx, int16_t sy,
+                              uint8_t dstLayer, int16_t dx, int16_t dy,
+                              int16_t w, int16_t h, enum RA8875bteDir dir) {
+  bteRop(srcLayer, sx, sy, dstLayer, dx, dy, w, h, RA8875_BTE_ROP_S, dir);
+}
 
-  /* Set Point 0 */
-  writeCommand(0x91);
-  writeData(x0);
-  writeCommand(0x92);
-  writeData(x0 >> 8);
-  writeCommand(0x93);
-  writeData(y0);
-  writeCommand(0x94);
-  writeData(y0 >> 8);
+/**************************************************************************/
+/*!
+      Combine a source rectangle with a destination rectangle in the
+      current layer using a BTE raster operation
+
+      @param sx  The 0-based x location of the source rectangle
+      @param sy  The 0-based y location of the source rectangle
+      @param dx  The 0-based x location of the destination rectangle
+      @param dy  The 0-based y location of the destination rectangle
+      @param w   The rectangle width
+      @param h   The rectangle height
+      @param rop The raster operation (RA8875_BTE_ROP_*) giving the new
+                 destination from the source S and destination D
+      @param dir The copy direction, RA8875_BTE_AUTO picks the one that is
+                 safe for overlapping rectangles
+*/
+/**************************************************************************/
+void Adafruit_RA8875::bteRop(int16_t sx, int16_t sy, int16_t dx, int16_t dy,
+                             int16_t w, int16_t h, uint8_t rop,
+                             enum RA8875bteDir dir) {
+  bteRop(_layer, sx, sy, _layer, dx, dy, w, h, rop, dir);
+}
 
-  /* Set Point 1 */
-  writeCommand(0x95);
-  writeData(x1);
-  writeCommand(0x96);
-  writeData(x1 >> 8);
-  writeCommand(0x97);
-  writeData(y1);
-  writeCommand(0x98);
-  writeData(y1 >> 8);
+/**************************************************************************/
+/*!
+      Combine a source rectangle with a destination rectangle, possibly on
+      different layers, using a BTE raster operation. Only the part of the
+      destination inside the clip rectangle changes.
+
+      @param srcLayer The source layer, RA8875_LAYER1 or RA8875_LAYER2
+      @param sx       The 0-based x location of the source rectangle
+      @param sy       The 0-based y location of the source rectangle
+      @param dstLayer The destination layer, RA8875_LAYER1 or RA8875_LAYER2
+      @param dx       The 0-based x location of the destination rectangle
+      @param dy       The 0-based y location of the destination rectangle
+      @param w        The rectangle width
+      @param h        The rectangle height
+      @param rop      The raster operation (RA8875_BTE_ROP_*) giving the new
+                      destination from the source S and destination D
+      @param dir      The copy direction relative to the current rotation,
+                      RA8875_BTE_AUTO picks the one that is safe for
+                      overlapping rectangles
+*/
+/**************************************************************************/
+void Adafruit_RA8875::bteRop(uint8_t srcLayer, int16_t sx, int16_t sy,
+                             uint8_t dstLayer, int16_t dx, int16_t dy,
+                             int16_t w, int16_t h, uint8_t rop,
+                             enum RA8875bteDir dir) {
+  /* Clip the destination and move the source along with it */
+  int16_t ox, oy;
+  if (!clipRect(dx, dy, w, h, ox, oy))
+    return;
+  sx += ox;
+  sy += oy;
+
+  /* Copy backwards when the destination overlaps the source further on in
+     memory order, which is columns at rotations 1 and 3. The column order
+     can need the other direction than the logical rows, so there the
+     direction always comes from the memory order. */
+  int16_t psx = sx, psy = sy, pdx = dx, pdy = dy;
+  applyRotation(psx, psy);
+  applyRotation(pdx, pdy);
+  bool backward;
+  if ((dir == RA8875_BTE_AUTO) || (_rotation & 1)) {
+    backward = (srcLayer == dstLayer) &&
+               ((pdy > psy) || ((pdy == psy) && (pdx > psx)));
+  } else {
+    backward = (dir == RA8875_BTE_BACKWARD);
+  }
 
-  /* Set Point 2 */
-  writeCommand(0xA9);
-  writeData(x2);
-  writeCommand(0xAA);
-  writeData(x2 >> 8);
-  writeCommand(0xAB);
-  writeData(y2);
-  writeCommand(0xAC);
-  writeData(y2 >> 8);
+  bteStart(srcLayer, sx, sy, dstLayer, dx, dy, w, h,
+           backward ? RA8875_BTE_MOVE_NEG : RA8875_BTE_MOVE_POS, rop);
+  waitEngine(RA8875_BECR0, RA8875_BECR0_ENABLE);
+}
 
-  /* Set Color */
-  writeCommand(0x63);
-  writeData((color & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((color & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((color & 0x001f));
+/**************************************************************************/
+/*!
+      Combine MCU pixel data with a rectangle of the current layer using a
+      BTE raster operation, e.g. RA8875_BTE_ROP_AND to mask it. Only the
+      part of the rectangle inside the clip rectangle changes.
+
+      @param x      The 0-based x location of the rectangle
+      @param y      The 0-based y location of the rectangle
+      @param w      The rectangle width
+      @param h      The rectangle height
+      @param pixels The w * h RGB565 source pixels, row by row
+      @param rop    The raster operation (RA8875_BTE_ROP_*) giving the new
+                    destination from the source S and destination D
+*/
+/**************************************************************************/
+void Adafruit_RA8875::bteWrite(int16_t x, int16_t y, int16_t w, int16_t h,
+                               const uint16_t* pixels, uint8_t rop) {
+  int16_t sx, sy, cw = w, ch = h;
+  if (!clipRect(x, y, cw, ch, sx, sy))
+    return;
 
-  /* Draw! */
-  writeCommand(RA8875_DCR);
-  if (filled) {
-    writeData(0xA1);
+  beginBurst();
+  bteStart(_layer, x, y, _layer, x, y, cw, ch, RA8875_BTE_WRITE, rop);
+  /* bteStart() flushes a pending pixel run, which sets its own dither */
+  ditherStart(x, y, cw);
+  writeCommand(RA8875_MRWC);
+  beginFrame(RA8875_DATAWRITE);
+  if (_rotation & 1) {
+    /* The engine fills in memory order, walk the pixels to match */
+    for (int16_t j = 0; j < cw; j++) {
+      ditherStart(x + j, y, 1);
+      for (int16_t i = 0; i < ch; i++) {
+        int16_t lx, ly;
+        logicalOffset(i, j, lx, ly);
+        streamPixel(pixels[(int32_t)(sy + ly) * w + sx + lx]);
+      }
+    }
+  } else if (cw == w) {
+    writePixelData(pixels + (int32_t)sy * w, 0, (uint32_t)cw * ch);
   } else {
-    writeData(0x81);
+    for (int16_t j = 0; j < ch; j++)
+      writePixelData(pixels + (int32_t)(sy + j) * w + sx, 0, cw);
   }
+  endFrame();
+  endBurst();
+  waitEngine(RA8875_BECR0, RA8875_BECR0_ENABLE);
+}
 
-  /* Wait for the command to finish */
-  waitPoll(RA8875_DCR, RA8875_DCR_LINESQUTRI_STATUS);
+/**************************************************************************/
+/*!
+      Copy a rectangle within the current layer, skipping the pixels that
+      match a key color
+
+      @param sx  The 0-based x location of the source rectangle
+      @param sy  The 0-based y location of the source rectangle
+      @param dx  The 0-based x location of the destination rectangle
+      @param dy  The 0-based y location of the destination rectangle
+      @param w   The rectangle width
+      @param h   The rectangle height
+      @param key The RGB565 color that is left transparent
+*/
+/**************************************************************************/
+void Adafruit_RA8875::bteMoveTransparent(int16_t sx, int16_t sy, int16_t dx,
+                                         int16_t dy, int16_t w, int16_t h,
+                                         uint16_t key) {
+  bteMoveTransparent(_layer, sx, sy, _layer, dx, dy, w, h, key);
 }
 
 /**************************************************************************/
 /*!
-      Helper function for higher level ellipse drawing code
+      Copy a rectangle, skipping the pixels that match a key color. With a
+      sprite sheet kept in the hidden layer, drawing a sprite over the
+      visible one takes a few register writes and no pixel data.
+
+      @param srcLayer The source layer, RA8875_LAYER1 or RA8875_LAYER2
+      @param sx       The 0-based x location of the source rectangle
+      @param sy       The 0-based y location of the source rectangle
+      @param dstLayer The destination layer, RA8875_LAYER1 or RA8875_LAYER2
+      @param dx       The 0-based x location of the destination rectangle
+      @param dy       The 0-based y location of the destination rectangle
+      @param w        The rectangle width
+      @param h        The rectangle height
+      @param key      The RGB565 color that is left transparent
 */
 /**************************************************************************/
-void Adafruit_RA8875::ellipseHelper(int16_t xCenter, int16_t yCenter,
-                                    int16_t longAxis, int16_t shortAxis,
-                                    uint16_t color, bool filled) {
-  xCenter = applyRotationX(xCenter);
-  yCenter = applyRotationY(yCenter);
+void Adafruit_RA8875::bteMoveTransparent(uint8_t srcLayer, int16_t sx,
+                                         int16_t sy, uint8_t dstLayer,
+                                         int16_t dx, int16_t dy, int16_t w,
+                                         int16_t h, uint16_t key) {
+  int16_t ox, oy;
+  if (!clipRect(dx, dy, w, h, ox, oy))
+    return;
+  sx += ox;
+  sy += oy;
+
+  /* The key color goes in the foreground color registers */
+  sync();
+  beginBurst();
+  writeColor(0x63, key);
+  bteStart(srcLayer, sx, sy, dstLayer, dx, dy, w, h, RA8875_BTE_MOVE_TRANS, 0);
+  endBurst();
+  waitEngine(RA8875_BECR0, RA8875_BECR0_ENABLE);
+}
 
-  /* Set Center Point */
-  writeCommand(0xA5);
-  writeData(xCenter);
-  writeCommand(0xA6);
-  writeData(xCenter >> 8);
-  writeCommand(0xA7);
-  writeData(yCenter);
-  writeCommand(0xA8);
-  writeData(yCenter >> 8);
+/**************************************************************************/
+/*!
+      Invert a rectangle of the current layer in place. Inverting it again
+      restores it, which makes for highlights that cost no pixel data.
 
-  /* Set Long and Short Axis */
-  writeCommand(0xA1);
-  writeData(longAxis);
-  writeCommand(0xA2);
-  writeData(longAxis >> 8);
-  writeCommand(0xA3);
-  writeData(shortAxis);
-  writeCommand(0xA4);
-  writeData(shortAxis >> 8);
+      @param x The 0-based x location of the rectangle
+      @param y The 0-based y location of the rectangle
+      @param w The rectangle width
+      @param h The rectangle height
+*/
+/**************************************************************************/
+void Adafruit_RA8875::bteInvert(int16_t x, int16_t y, int16_t w, int16_t h) {
+  bteRop(x, y, x, y, w, h, RA8875_BTE_ROP_NOT_D, RA8875_BTE_FORWARD);
+}
 
-  /* Set Color */
-  writeCommand(0x63);
-  writeData((color & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((color & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((color & 0x001f));
+/**************************************************************************/
+/*!
+      Draw a rectangle outline by inverting the pixels under it. Drawing
+      the same rectangle again erases it, as needed for rubber-band
+      selection frames.
+
+      @param x The 0-based x location of the rectangle
+      @param y The 0-based y location of the rectangle
+      @param w The rectangle width
+      @param h The rectangle height
+*/
+/**************************************************************************/
+void Adafruit_RA8875::drawXorRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if ((w <= 0) || (h <= 0))
+    return;
+
+  bteInvert(x, y, w, 1);
+  if (h > 1)
+    bteInvert(x, y + h - 1, w, 1);
+  if (h > 2) {
+    bteInvert(x, y + 1, 1, h - 2);
+    if (w > 1)
+      bteInvert(x + w - 1, y + 1, 1, h - 2);
+  }
+}
 
-  /* Draw! */
-  writeCommand(0xA0);
-  if (filled) {
-    writeData(0xC0);
-  } else {
-    writeData(0x80);
+/**************************************************************************/
+/*!
+      Program and start a BTE operation on two rectangles of the same size.
+      The caller streams any MCU data and then waits for the engine.
+
+      @param srcLayer The source layer
+      @param sx       The 0-based x location of the source rectangle
+      @param sy       The 0-based y location of the source rectangle
+      @param dstLayer The destination layer
+      @param dx       The 0-based x location of the destination rectangle
+      @param dy       The 0-based y location of the destination rectangle
+      @param w        The rectangle width
+      @param h        The rectangle height
+      @param op       The BTE operation code (RA8875_BTE_*)
+      @param rop      The raster operation code (RA8875_BTE_ROP_*)
+*/
+/**************************************************************************/
+void Adafruit_RA8875::bteStart(uint8_t srcLayer, int16_t sx, int16_t sy,
+                               uint8_t dstLayer, int16_t dx, int16_t dy,
+                               int16_t w, int16_t h, uint8_t op, uint8_t rop) {
+  /* Find the rectangles in controller coordinates, the rotation may swap
+     their sides and move their top-left corners */
+  int16_t sx1 = sx + w - 1, sy1 = sy + h - 1;
+  int16_t dx1 = dx + w - 1, dy1 = dy + h - 1;
+  applyRotation(sx, sy);
+  applyRotation(sx1, sy1);
+  applyRotation(dx, dy);
+  applyRotation(dx1, dy1);
+  if (sx > sx1) {
+    swap(sx, sx1);
+    swap(dx, dx1);
+  }
+  if (sy > sy1) {
+    swap(sy, sy1);
+    swap(dy, dy1);
+  }
+  if (_rotation & 1)
+    swap(w, h);
+
+  /* Negative moves start from the bottom-right corner */
+  if (op == RA8875_BTE_MOVE_NEG) {
+    sx = sx1;
+    sy = sy1;
+    dx = dx1;
+    dy = dy1;
   }
 
-  /* Wait for the command to finish */
-  waitPoll(RA8875_ELLIPSE, RA8875_ELLIPSE_STATUS);
+  sync();
+  beginBurst();
+  /* Only moves read a source, writes and expansions take MCU data */
+  if ((op == RA8875_BTE_MOVE_POS) || (op == RA8875_BTE_MOVE_NEG) ||
+      (op == RA8875_BTE_MOVE_TRANS)) {
+    writeReg16(RA8875_HSBE0, sx);
+    writeReg16(RA8875_VSBE0, sy | (srcLayer ? RA8875_VSBE1_LAYER << 8 : 0));
+  }
+  writeReg16(RA8875_HDBE0, dx);
+  writeReg16(RA8875_VDBE0, dy | (dstLayer ? RA8875_VDBE1_LAYER << 8 : 0));
+  writeReg16(RA8875_BEWR0, w);
+  writeReg16(RA8875_BEHR0, h);
+  writeReg(RA8875_BECR1, (rop << 4) | op);
+
+  /* Drop a stale completion flag before waiting on the INT pin */
+  if (_intPin >= 0)
+    writeReg(RA8875_INTC2, RA8875_INTC2_BTE);
+  writeReg(RA8875_BECR0, RA8875_BECR0_ENABLE);
+  endBurst();
 }
 
+/************************* Asset Cache *********************************/
+
+/* Slot indexes are returned as int8_t, with -1 for no slot */
+static_assert(RA8875_ASSET_SLOTS <= 127, "RA8875_ASSET_SLOTS must be <= 127");
+
 /**************************************************************************/
 /*!
-      Helper function for higher level curve drawing code
+      Sets the area of display memory used to cache assets, usually in the
+      layer that is not shown. Any cached assets are forgotten. Assets are
+      kept for the current rotation only. Double buffering uses both
+      layers, so no area can be set while it is on.
+
+      @param layer The layer holding the area, RA8875_LAYER1 or RA8875_LAYER2
+      @param x     The 0-based x location of the area
+      @param y     The 0-based y location of the area
+      @param w     The area width, the area must lie within the screen
+      @param h     The area height
+
+      @return False if double buffering is on
 */
 /**************************************************************************/
-void Adafruit_RA8875::curveHelper(int16_t xCenter, int16_t yCenter,
-                                  int16_t longAxis, int16_t shortAxis,
-                                  uint8_t curvePart, uint16_t color,
-                                  bool filled) {
-  xCenter = applyRotationX(xCenter);
-  yCenter = applyRotationY(yCenter);
-  curvePart = (curvePart + _rotation) % 4;
+boolean Adafruit_RA8875::setAssetCache(uint8_t layer, int16_t x, int16_t y,
+                                       int16_t w, int16_t h) {
+  if (_doubleBuffer && (w > 0) && (h > 0))
+    return false;
 
-  /* Set Center Point */
-  writeCommand(0xA5);
-  writeData(xCenter);
-  writeCommand(0xA6);
-  writeData(xCenter >> 8);
-  writeCommand(0xA7);
-  writeData(yCenter);
-  writeCommand(0xA8);
-  writeData(yCenter >> 8);
+  _cacheLayer = layer;
+  _cacheX = x;
+  _cacheY = y;
+  _cacheW = w;
+  _cacheH = h;
+  clearAssetCache();
+  return true;
+}
 
-  /* Set Long and Short Axis */
-  writeCommand(0xA1);
-  writeData(longAxis);
-  writeCommand(0xA2);
-  writeData(longAxis >> 8);
-  writeCommand(0xA3);
-  writeData(shortAxis);
-  writeCommand(0xA4);
-  writeData(shortAxis >> 8);
+/**************************************************************************/
+/*!
+      Forget all cached assets
+*/
+/**************************************************************************/
+void Adafruit_RA8875::clearAssetCache(void) {
+  for (uint8_t i = 0; i < RA8875_ASSET_SLOTS; i++)
+    _assets[i].w = 0;
+}
 
-  /* Set Color */
-  writeCommand(0x63);
-  writeData((color & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((color & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((color & 0x001f));
+/**************************************************************************/
+/*!
+      Reserve an area of the asset cache, evicting the least recently used
+      assets if needed. The caller draws the contents, e.g. a glyph atlas.
 
-  /* Draw! */
-  writeCommand(0xA0);
-  if (filled) {
-    writeData(0xD0 | (curvePart & 0x03));
-  } else {
-    writeData(0x90 | (curvePart & 0x03));
-  }
+      @param id The ID to reserve the area under
+      @param w  The area width
+      @param h  The area height
+      @param x  Set to the x location of the area
+      @param y  Set to the y location of the area
 
-  /* Wait for the command to finish */
-  waitPoll(RA8875_ELLIPSE, RA8875_ELLIPSE_STATUS);
+      @return False if the area cannot fit in the cache
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::allocAsset(uint16_t id, int16_t w, int16_t h,
+                                    int16_t* x, int16_t* y) {
+  int8_t i = allocHelper(id, w, h);
+  if (i < 0)
+    return false;
+
+  *x = _assets[i].x;
+  *y = _assets[i].y;
+  return true;
 }
 
 /**************************************************************************/
 /*!
-      Helper function for higher level rounded rectangle drawing code
- */
+      Upload a PROGMEM-resident RGB565 bitmap to the asset cache. Nothing
+      is sent if the ID is already cached.
+
+      @param id     The ID to cache the bitmap under
+      @param bitmap The RGB565 pixel data (in PROGMEM)
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
+
+      @return False if the bitmap cannot fit in the cache
+*/
 /**************************************************************************/
-void Adafruit_RA8875::roundRectHelper(int16_t x, int16_t y, int16_t w,
-                                      int16_t h, int16_t r, uint16_t color,
-                                      bool filled) {
-  x = applyRotationX(x);
-  y = applyRotationY(y);
-  w = applyRotationX(w);
-  h = applyRotationY(h);
-  if (x > w)
-    swap(x, w);
-  if (y > h)
-    swap(y, h);
+boolean Adafruit_RA8875::cacheAsset(uint16_t id, const uint16_t bitmap[],
+                                    int16_t w, int16_t h) {
+  return cacheHelper(id, bitmap, w, h, true);
+}
 
-  /* Set X */
-  writeCommand(0x91);
-  writeData(x);
-  writeCommand(0x92);
-  writeData(x >> 8);
+/**************************************************************************/
+/*!
+      Upload a RAM-resident RGB565 bitmap to the asset cache. Nothing is
+      sent if the ID is already cached.
 
-  /* Set Y */
-  writeCommand(0x93);
-  writeData(y);
-  writeCommand(0x94);
-  writeData(y >> 8);
+      @param id     The ID to cache the bitmap under
+      @param bitmap The RGB565 pixel data (in RAM)
+      @param w      The bitmap width in pixels
+      @param h      The bitmap height in pixels
 
-  /* Set X1 */
-  writeCommand(0x95);
-  writeData(w);
-  writeCommand(0x96);
-  writeData((w) >> 8);
+      @return False if the bitmap cannot fit in the cache
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::cacheAsset(uint16_t id, uint16_t* bitmap, int16_t w,
+                                    int16_t h) {
+  return cacheHelper(id, bitmap, w, h, false);
+}
 
-  /* Set Y1 */
-  writeCommand(0x97);
-  writeData(h);
-  writeCommand(0x98);
-  writeData((h) >> 8);
+/**************************************************************************/
+/*!
+      Checks whether an asset is in the cache
 
-  writeCommand(0xA1);
-  writeData(r);
-  writeCommand(0xA2);
-  writeData((r) >> 8);
+      @param id The asset ID
 
-  writeCommand(0xA3);
-  writeData(r);
-  writeCommand(0xA4);
-  writeData((r) >> 8);
+      @return True if the asset is cached
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::isCached(uint16_t id) { return findAsset(id) >= 0; }
+
+/**************************************************************************/
+/*!
+      Remove an asset from the cache
+
+      @param id The asset ID
+*/
+/**************************************************************************/
+void Adafruit_RA8875::evictAsset(uint16_t id) {
+  int8_t i = findAsset(id);
+  if (i >= 0)
+    _assets[i].w = 0;
+}
+
+/**************************************************************************/
+/*!
+      Draw a cached asset with a BTE move, no pixel data crosses the bus
+
+      @param id The asset ID
+      @param x  The 0-based x location of the top-left corner
+      @param y  The 0-based y location of the top-left corner
+
+      @return False if the asset is not cached
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawCached(uint16_t id, int16_t x, int16_t y) {
+  return drawCachedHelper(id, x, y, 0, false);
+}
 
-  /* Set Color */
-  writeCommand(0x63);
-  writeData((color & 0xf800) >> 11);
-  writeCommand(0x64);
-  writeData((color & 0x07e0) >> 5);
-  writeCommand(0x65);
-  writeData((color & 0x001f));
+/**************************************************************************/
+/*!
+      Draw a cached asset with a transparent BTE move, leaving the pixels
+      that match the key color untouched
 
-  /* Draw! */
-  writeCommand(RA8875_ELLIPSE);
-  if (filled) {
-    writeData(0xE0);
-  } else {
-    writeData(0xA0);
-  }
+      @param id  The asset ID
+      @param x   The 0-based x location of the top-left corner
+      @param y   The 0-based y location of the top-left corner
+      @param key The RGB565 color that is left transparent
 
-  /* Wait for the command to finish */
-  waitPoll(RA8875_ELLIPSE, RA8875_DCR_LINESQUTRI_STATUS);
+      @return False if the asset is not cached
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawCached(uint16_t id, int16_t x, int16_t y,
+                                    uint16_t key) {
+  return drawCachedHelper(id, x, y, key, true);
 }
+
 /**************************************************************************/
 /*!
-      Set the scroll window
+      Helper function for drawCached()
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawCachedHelper(uint16_t id, int16_t x, int16_t y,
+                                          uint16_t key, bool transparent) {
+  int8_t i = findAsset(id);
+  if (i < 0)
+    return false;
+  _assets[i].used = ++_assetTick;
 
-      @param x  X position of the scroll window
-      @param y  Y position of the scroll window
-      @param w  Width of the Scroll Window
-      @param h  Height of the Scroll window
-      @param mode Layer to Scroll
+  int16_t sx, sy, w = _assets[i].w, h = _assets[i].h;
+  if (!clipRect(x, y, w, h, sx, sy))
+    return true;
+
+  sx += _assets[i].x;
+  sy += _assets[i].y;
+  if (transparent)
+    bteMoveTransparent(_cacheLayer, sx, sy, _layer, x, y, w, h, key);
+  else
+    bteMove(_cacheLayer, sx, sy, _layer, x, y, w, h);
+  return true;
+}
 
- */
 /**************************************************************************/
-void Adafruit_RA8875::setScrollWindow(int16_t x, int16_t y, int16_t w,
-                                      int16_t h, uint8_t mode) {
-  // Horizontal Start point of Scroll Window
-  writeCommand(0x38);
-  writeData(x);
-  writeCommand(0x39);
-  writeData(x >> 8);
+/*!
+      Helper function for cacheAsset()
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::cacheHelper(uint16_t id, const uint16_t* bitmap,
+                                     int16_t w, int16_t h, bool progmem) {
+  if (findAsset(id) >= 0)
+    return true;
 
-  // Vertical Start Point of Scroll Window
-  writeCommand(0x3a);
-  writeData(y);
-  writeCommand(0x3b);
-  writeData(y >> 8);
+  int8_t i = allocHelper(id, w, h);
+  if (i < 0)
+    return false;
 
-  // Horizontal End Point of Scroll Window
-  writeCommand(0x3c);
-  writeData(x + w);
-  writeCommand(0x3d);
-  writeData((x + w) >> 8);
+  /* The clip rectangle is for the screen, not the cache area */
+  int16_t cx0 = _clipX0, cy0 = _clipY0, cx1 = _clipX1, cy1 = _clipY1;
+  _clipX0 = _clipY0 = 0;
+  _clipX1 = width() - 1;
+  _clipY1 = height() - 1;
+
+  uint8_t layer = _layer;
+  if (layer != _cacheLayer)
+    setLayer(_cacheLayer);
+  rgbBitmapHelper(_assets[i].x, _assets[i].y, bitmap, w, h, progmem);
+  if (layer != _cacheLayer)
+    setLayer(layer);
+
+  _clipX0 = cx0;
+  _clipY0 = cy0;
+  _clipX1 = cx1;
+  _clipY1 = cy1;
+  resetActiveWindow();
+  return true;
+}
 
-  // Vertical End Point of Scroll Window
-  writeCommand(0x3e);
-  writeData(y + h);
-  writeCommand(0x3f);
-  writeData((y + h) >> 8);
+/**************************************************************************/
+/*!
+      Find the slot of a cached asset
+
+      @param id The asset ID
 
-  // Scroll function setting
-  writeCommand(0x52);
-  writeData(mode);
+      @return The slot index, or -1 if the asset is not cached
+*/
+/**************************************************************************/
+int8_t Adafruit_RA8875::findAsset(uint16_t id) {
+  for (uint8_t i = 0; i < RA8875_ASSET_SLOTS; i++)
+    if (_assets[i].w && (_assets[i].id == id))
+      return i;
+  return -1;
 }
 
 /**************************************************************************/
 /*!
-    Scroll in the X direction
+      Place a new asset in the cache. Positions next to and below the
+      assets already placed are tried, and the one closest to the top-left
+      corner is taken. Least recently used assets are evicted until the
+      asset fits.
 
-    @param dist The distance to scroll
+      @param id The asset ID
+      @param w  The asset width
+      @param h  The asset height
 
- */
+      @return The slot index, or -1 if the asset cannot fit
+*/
 /**************************************************************************/
-void Adafruit_RA8875::scrollX(int16_t dist) {
-  writeCommand(0x24);
-  writeData(dist);
-  writeCommand(0x25);
-  writeData(dist >> 8);
+int8_t Adafruit_RA8875::allocHelper(uint16_t id, int16_t w, int16_t h) {
+  evictAsset(id);
+  if ((w <= 0) || (h <= 0) || (w > _cacheW) || (h > _cacheH))
+    return -1;
+
+  while (1) {
+    int8_t slot = -1, lru = -1;
+    int16_t bestX = 0, bestY = -1;
+
+    /* Index RA8875_ASSET_SLOTS stands for the cache origin */
+    for (uint8_t i = 0; i <= RA8875_ASSET_SLOTS; i++) {
+      bool origin = (i == RA8875_ASSET_SLOTS);
+      int16_t cx = _cacheX, cy = _cacheY;
+      if (!origin) {
+        if (!_assets[i].w) {
+          if (slot < 0)
+            slot = i;
+          continue;
+        }
+        if ((lru < 0) || (_assets[i].used < _assets[lru].used))
+          lru = i;
+      }
+
+      /* Try the cache origin, then right of and below each asset */
+      for (uint8_t c = 0; c < (origin ? 1 : 3); c++) {
+        if (!origin) {
+          cx = (c == 0) ? _assets[i].x + _assets[i].w : _cacheX;
+          cy = (c == 0) ? _assets[i].y : _assets[i].y + _assets[i].h;
+          if (c == 2)
+            cx = _assets[i].x;
+        }
+        if (((bestY < 0) || (cy < bestY) || ((cy == bestY) && (cx < bestX))) &&
+            assetFits(cx, cy, w, h)) {
+          bestX = cx;
+          bestY = cy;
+        }
+      }
+    }
+
+    if ((slot >= 0) && (bestY >= 0)) {
+      _assets[slot].id = id;
+      _assets[slot].x = bestX;
+      _assets[slot].y = bestY;
+      _assets[slot].w = w;
+      _assets[slot].h = h;
+      _assets[slot].used = ++_assetTick;
+      return slot;
+    }
+
+    /* No room or no free slot, make some */
+    if (lru < 0)
+      return -1;
+    _assets[lru].w = 0;
+  }
 }
 
 /**************************************************************************/
 /*!
-     Scroll in the Y direction
+      Checks whether a rectangle lies in the asset cache without
+      overlapping any cached asset
 
-     @param dist The distance to scroll
+      @param x The x location of the rectangle
+      @param y The y location of the rectangle
+      @param w The rectangle width
+      @param h The rectangle height
 
- */
+      @return True if the rectangle is free
+*/
 /**************************************************************************/
-void Adafruit_RA8875::scrollY(int16_t dist) {
-  writeCommand(0x26);
-  writeData(dist);
-  writeCommand(0x27);
-  writeData(dist >> 8);
+bool Adafruit_RA8875::assetFits(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if ((x + w > _cacheX + _cacheW) || (y + h > _cacheY + _cacheH))
+    return false;
+
+  for (uint8_t i = 0; i < RA8875_ASSET_SLOTS; i++) {
+    tsAsset_t* a = &_assets[i];
+    if (a->w && (x < a->x + a->w) && (a->x < x + w) && (y < a->y + a->h) &&
+        (a->y < y + h))
+      return false;
+  }
+  return true;
 }
 
 /************************* Mid Level ***********************************/
@@ -1539,10 +3672,10 @@ void Adafruit_RA8875::touchEnable(boolean on) {
                                // RA8875_TPCR1_VREFEXT |
                                RA8875_TPCR1_DEBOUNCE);
     /* Enable TP INT */
-    writeReg(RA8875_INTC1, readReg(RA8875_INTC1) | RA8875_INTC1_TP);
+    writeReg(RA8875_INTC1, readShadowReg(RA8875_INTC1) | RA8875_INTC1_TP);
   } else {
     /* Disable TP INT */
-    writeReg(RA8875_INTC1, readReg(RA8875_INTC1) & ~RA8875_INTC1_TP);
+    writeReg(RA8875_INTC1, readShadowReg(RA8875_INTC1) & ~RA8875_INTC1_TP);
     /* Disable Touch Panel (Reg 0x70) */
     writeReg(RA8875_TPCR0, RA8875_TPCR0_DISABLE);
   }
@@ -1624,6 +3757,71 @@ void Adafruit_RA8875::sleep(boolean sleep) {
     writeReg(RA8875_PWRR, RA8875_PWRR_DISPOFF);
 }
 
+/**************************************************************************/
+/*!
+    Selects the color depth of display memory. 8bpp stores RGB332 pixels,
+    which halves the SPI traffic of every pixel write and leaves room for
+    two layers on the 800x480 panel. Drawing calls keep taking RGB565
+    colors and convert them. Memory contents and the text colors are not
+    converted, so redraw the screen after switching. Going back to 16bpp
+    turns the second layer, and double buffering, off when two layers no
+    longer fit.
+
+    @param bpp 8 or 16
+
+    @return False if bpp is not a supported depth
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::setColorDepth(uint8_t bpp) {
+  if ((bpp != 8) && (bpp != 16))
+    return false;
+
+  sync();
+  if ((bpp == 16) && (readShadowReg(RA8875_DPCR) & RA8875_DPCR_LAYERS2) &&
+      ((uint32_t)_width * _height * 2 * 2 > RA8875_DISPLAY_RAM))
+    enableLayers(false);
+
+  _bpp = bpp;
+  writeReg(RA8875_SYSR,
+           (readShadowReg(RA8875_SYSR) & ~RA8875_SYSR_COLORMASK) |
+               (bpp == 8 ? RA8875_SYSR_8BPP : RA8875_SYSR_16BPP));
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    Returns the color depth of display memory
+
+    @return 8 or 16
+*/
+/**************************************************************************/
+uint8_t Adafruit_RA8875::getColorDepth(void) { return _bpp; }
+
+/**************************************************************************/
+/*!
+    Enables or disables ordered (4x4 Bayer) dithering of RGB565 pixel data
+    in 8bpp mode. Smooth gradients keep their look at the cost of some
+    conversion time. Colors that are exact RGB332 values are not changed.
+
+    @param on Whether to dither pixel data
+*/
+/**************************************************************************/
+void Adafruit_RA8875::setDither(boolean on) { _dither = on; }
+
+/**************************************************************************/
+/*!
+    Converts an RGB565 color to the RGB332 format of 8bpp mode by keeping
+    the top bits of each component
+
+    @param color The RGB565 color
+
+    @return The RGB332 color
+*/
+/**************************************************************************/
+uint8_t Adafruit_RA8875::color332(uint16_t color) {
+  return ((color >> 8) & 0xE0) | ((color >> 6) & 0x1C) | ((color >> 3) & 0x03);
+}
+
 /************************* Low Level ***********************************/
 
 /**************************************************************************/
@@ -1635,8 +3833,283 @@ void Adafruit_RA8875::sleep(boolean sleep) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::writeReg(uint8_t reg, uint8_t val) {
+  beginBurst();
   writeCommand(reg);
   writeData(val);
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+    Update the register caches after a register write. Called for every
+    data write, so registers changed with writeCommand()/writeData() stay
+    in step as well.
+
+    @param reg The register written
+    @param val The value written
+*/
+/**************************************************************************/
+void Adafruit_RA8875::trackWrite(uint8_t reg, uint8_t val) {
+  if (_shadowEnabled) {
+    int8_t i = shadowIndex(reg);
+    if (i >= 0) {
+      _shadow[i] = val;
+      _shadowValid |= (1 << i);
+    }
+  }
+
+  int8_t slot = cacheSlot(reg);
+  if (slot >= 0) {
+    _cached[slot] = val;
+    _cachedValid |= ((uint32_t)1 << slot);
+  } else if (reg == 0x22) {
+    _textTransparent = (val & (1 << 6)) ? 1 : 0;
+  }
+}
+
+/**************************************************************************/
+/*!
+    Write to a register unless the write cache is enabled and the register
+    is known to already hold the value. Only registers tracked by
+    cacheSlot() are skipped, anything else is written.
+
+    @param reg Register to write to
+    @param val Value to write
+*/
+/**************************************************************************/
+void Adafruit_RA8875::writeRegCached(uint8_t reg, uint8_t val) {
+  int8_t slot = cacheSlot(reg);
+  if (_writeCache && slot >= 0 && (_cachedValid & ((uint32_t)1 << slot)) &&
+      _cached[slot] == val) {
+    _skippedWrites++;
+    return;
+  }
+  writeReg(reg, val);
+}
+
+/**************************************************************************/
+/*!
+    Find the slot a register uses in the write cache. The color registers
+    (0x60-0x65) and the draw engine geometry registers (0x91-0x9D and
+    0xA1-0xAC) are tracked, so consecutive primitives only send the bytes
+    that actually changed.
+
+    @param reg The register to look up
+
+    @return The cache slot, or -1 if writes to the register are not cached
+*/
+/**************************************************************************/
+int8_t Adafruit_RA8875::cacheSlot(uint8_t reg) {
+  if (reg >= 0x60 && reg <= 0x65)
+    return reg - 0x60;
+  if (reg >= 0x91 && reg <= 0x9D)
+    return reg - 0x91 + 6;
+  if (reg >= 0xA1 && reg <= 0xAC)
+    return reg - 0xA1 + 19;
+  return -1;
+}
+
+/**************************************************************************/
+/*!
+    Returns how many register writes were skipped because the register
+    already held the requested value
+
+    @return The number of skipped writes since the last clearSkippedWrites()
+*/
+/**************************************************************************/
+uint32_t Adafruit_RA8875::skippedWrites(void) {
+  return _skippedWrites;
+}
+
+/**************************************************************************/
+/*!
+    Reset the skipped register write counter
+*/
+/**************************************************************************/
+void Adafruit_RA8875::clearSkippedWrites(void) {
+  _skippedWrites = 0;
+}
+
+/**************************************************************************/
+/*!
+    Write a list of register/value pairs in a single SPI transaction. CS is
+    still toggled between each command and data cycle as the RA8875 requires,
+    but the bus is only claimed and configured once.
+
+    @param regs  Array of alternating register addresses and values
+    @param count The number of register/value pairs in the array
+*/
+/**************************************************************************/
+void Adafruit_RA8875::writeRegs(const uint8_t* regs, uint8_t count) {
+  beginBurst();
+  while (count--) {
+    writeReg(regs[0], regs[1]);
+    regs += 2;
+  }
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+    Write a 16-bit value to a low/high register pair
+
+    @param reg Address of the low byte register, the high byte goes to reg+1
+    @param val Value to write
+*/
+/**************************************************************************/
+void Adafruit_RA8875::writeReg16(uint8_t reg, uint16_t val) {
+  beginBurst();
+  writeRegCached(reg, val);
+  writeRegCached(reg + 1, val >> 8);
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+    Write an RGB565 color to a red/green/blue register triplet
+
+    @param reg   Address of the red register (0x60 background, 0x63 fore)
+    @param color The RGB565 color to write
+*/
+/**************************************************************************/
+void Adafruit_RA8875::writeColor(uint8_t reg, uint16_t color) {
+  beginBurst();
+  if (_bpp == 8) {
+    /* The registers hold 3/3/2 bit components in 8bpp mode */
+    uint8_t c = color332(color);
+    writeRegCached(reg, c >> 5);
+    writeRegCached(reg + 1, (c >> 2) & 0x07);
+    writeRegCached(reg + 2, c & 0x03);
+  } else {
+    writeRegCached(reg, (color & 0xf800) >> 11);
+    writeRegCached(reg + 1, (color & 0x07e0) >> 5);
+    writeRegCached(reg + 2, (color & 0x001f));
+  }
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+    Enables or disables the shadow register cache. When enabled, the mode
+    registers (SYSR, 0x21, 0x22, MWCR0, MWCR1, INTC1, DPCR and LTPR0) are
+    mirrored in the object so read-modify-write operations like textMode()
+    or graphicsMode() no longer need to read the register back over SPI.
+
+    @param on Whether to use the shadow register cache
+*/
+/**************************************************************************/
+void Adafruit_RA8875::enableRegisterCache(boolean on) {
+  _shadowEnabled = on;
+  _shadowValid = 0;
+}
+
+/**************************************************************************/
+/*!
+    Enables or disables the write cache. When enabled, writes to the color
+    registers and the draw engine geometry registers, and changes of the
+    text transparency, are skipped when the register already holds the
+    value, see skippedWrites(). Disabled by default.
+
+    @param on Whether to skip redundant register writes
+*/
+/**************************************************************************/
+void Adafruit_RA8875::enableWriteCache(boolean on) {
+  _writeCache = on;
+  _cachedValid = 0;
+  _textTransparent = -1;
+}
+
+/**************************************************************************/
+/*!
+    Forget all cached register values, so they are read back from the
+    RA8875 or written in full the next time they are needed. Writes made
+    through writeReg() or writeCommand()/writeData() are tracked
+    automatically, call this when the registers may have changed some
+    other way, e.g. through another driver sharing the controller.
+*/
+/**************************************************************************/
+void Adafruit_RA8875::invalidateRegisterCache(void) {
+  _shadowValid = 0;
+  _cachedValid = 0;
+  _textTransparent = -1;
+}
+
+/**************************************************************************/
+/*!
+    Reload the shadow register cache from the RA8875 in one burst
+*/
+/**************************************************************************/
+void Adafruit_RA8875::syncRegisterCache(void) {
+  if (!_shadowEnabled)
+    return;
+
+  _shadowValid = 0;
+  beginBurst();
+  for (uint8_t i = 0; i < RA8875_SHADOW_REGS; i++)
+    readShadowReg(shadowRegs[i]);
+  endBurst();
+}
+
+/**************************************************************************/
+/*!
+    Find a register in the shadow register cache
+
+    @param reg The register to look up
+
+    @return The cache slot, or -1 if the register is not mirrored
+*/
+/**************************************************************************/
+int8_t Adafruit_RA8875::shadowIndex(uint8_t reg) {
+  for (uint8_t i = 0; i < RA8875_SHADOW_REGS; i++) {
+    if (shadowRegs[i] == reg)
+      return i;
+  }
+  return -1;
+}
+
+/**************************************************************************/
+/*!
+    Read a register, using the shadow register cache when possible
+
+    @param reg Register to read
+
+    @return The value
+*/
+/**************************************************************************/
+uint8_t Adafruit_RA8875::readShadowReg(uint8_t reg) {
+  int8_t i = _shadowEnabled ? shadowIndex(reg) : -1;
+  if (i >= 0 && (_shadowValid & (1 << i)))
+    return _shadow[i];
+
+  uint8_t val = readReg(reg);
+  if (i >= 0) {
+    _shadow[i] = val;
+    _shadowValid |= (1 << i);
+  }
+  return val;
+}
+
+/**************************************************************************/
+/*!
+    Claim the SPI bus for a burst of transfers. Bursts may be nested, only
+    the outermost call starts an SPI transaction.
+*/
+/**************************************************************************/
+void Adafruit_RA8875::beginBurst(void) {
+  if (_burstDepth++ == 0) {
+    spi_begin();
+    RA8875_COUNT(transactions, 1);
+  }
+}
+
+/**************************************************************************/
+/*!
+    Release the SPI bus once the outermost burst has finished
+*/
+/**************************************************************************/
+void Adafruit_RA8875::endBurst(void) {
+  if (--_burstDepth == 0)
+    spi_end();
 }
 
 /**************************************************************************/
@@ -1661,12 +4134,12 @@ uint8_t Adafruit_RA8875::readReg(uint8_t reg) {
 */
 /**************************************************************************/
 void Adafruit_RA8875::writeData(uint8_t d) {
-  digitalWrite(_cs, LOW);
-  spi_begin();
-  SPI.transfer(RA8875_DATAWRITE);
-  SPI.transfer(d);
-  spi_end();
-  digitalWrite(_cs, HIGH);
+  beginBurst();
+  beginFrame(RA8875_DATAWRITE);
+  spiWrite(d);
+  endFrame();
+  endBurst();
+  trackWrite(_curReg, d);
 }
 
 /**************************************************************************/
@@ -1677,14 +4150,12 @@ void Adafruit_RA8875::writeData(uint8_t d) {
 */
 /**************************************************************************/
 uint8_t Adafruit_RA8875::readData(void) {
-  digitalWrite(_cs, LOW);
-  spi_begin();
-
-  SPI.transfer(RA8875_DATAREAD);
-  uint8_t x = SPI.transfer(0x0);
-  spi_end();
+  beginBurst();
+  beginFrame(RA8875_DATAREAD);
+  uint8_t x = spiWrite(0x0);
+  endFrame();
+  endBurst();
 
-  digitalWrite(_cs, HIGH);
   return x;
 }
 
@@ -1696,14 +4167,12 @@ uint8_t Adafruit_RA8875::readData(void) {
  */
 /**************************************************************************/
 void Adafruit_RA8875::writeCommand(uint8_t d) {
-  digitalWrite(_cs, LOW);
-  spi_begin();
-
-  SPI.transfer(RA8875_CMDWRITE);
-  SPI.transfer(d);
-  spi_end();
-
-  digitalWrite(_cs, HIGH);
+  _curReg = d;
+  beginBurst();
+  beginFrame(RA8875_CMDWRITE);
+  spiWrite(d);
+  endFrame();
+  endBurst();
 }
 
 /**************************************************************************/
@@ -1714,16 +4183,51 @@ void Adafruit_RA8875::writeCommand(uint8_t d) {
  */
 /**************************************************************************/
 uint8_t Adafruit_RA8875::readStatus(void) {
-  digitalWrite(_cs, LOW);
-  spi_begin();
-  SPI.transfer(RA8875_CMDREAD);
-  uint8_t x = SPI.transfer(0x0);
-  spi_end();
+  beginBurst();
+  beginFrame(RA8875_CMDREAD);
+  uint8_t x = spiWrite(0x0);
+  endFrame();
+  endBurst();
 
-  digitalWrite(_cs, HIGH);
   return x;
 }
 
+/**************************************************************************/
+/*!
+    Assert CS and send the cycle type byte that starts an SPI frame
+
+    @param cycle One of RA8875_DATAWRITE, RA8875_DATAREAD, RA8875_CMDWRITE
+                 or RA8875_CMDREAD
+*/
+/**************************************************************************/
+void Adafruit_RA8875::beginFrame(uint8_t cycle) {
+  digitalWrite(_cs, LOW);
+  SPI.transfer(cycle);
+  RA8875_COUNT(frames, 1);
+  RA8875_COUNT(bytes, 1);
+}
+
+/**************************************************************************/
+/*!
+    Deassert CS to end an SPI frame
+*/
+/**************************************************************************/
+void Adafruit_RA8875::endFrame(void) { digitalWrite(_cs, HIGH); }
+
+/**************************************************************************/
+/*!
+    Transfer one byte within an SPI frame
+
+    @param d The byte to send
+
+    @return The byte received
+*/
+/**************************************************************************/
+uint8_t Adafruit_RA8875::spiWrite(uint8_t d) {
+  RA8875_COUNT(bytes, 1);
+  return SPI.transfer(d);
+}
+
 /// @cond DISABLE
 #if defined(EEPROM_SUPPORTED)
 /// @endcond
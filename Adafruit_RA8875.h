@@ -74,6 +74,54 @@
 #endif
 #endif
 /// @endcond
+
+#define RA8875_SHADOW_REGS 8  ///< Number of registers in the shadow cache
+#define RA8875_CACHED_REGS 31 ///< Number of registers in the write cache
+
+#ifndef RA8875_POLL_TIMEOUT
+#define RA8875_POLL_TIMEOUT 1000 ///< Default status poll timeout in ms
+#endif
+
+#ifndef RA8875_RUN_SIZE
+#if defined(__AVR__)
+#define RA8875_RUN_SIZE 16 ///< Max pixels coalesced by writePixel()
+#else
+#define RA8875_RUN_SIZE 64 ///< Max pixels coalesced by writePixel()
+#endif
+#endif
+
+#ifndef RA8875_SPI_STATS
+#define RA8875_SPI_STATS 1 ///< Set to 0 to compile out enableSpiStats()
+#endif
+
+#ifndef RA8875_ASSET_SLOTS
+#if defined(__AVR__)
+#define RA8875_ASSET_SLOTS 4 ///< Max assets in the off-screen asset cache
+#else
+#define RA8875_ASSET_SLOTS 32 ///< Max assets in the off-screen asset cache
+#endif
+#endif
+
+#ifndef RA8875_LINEBUF_SIZE
+#if defined(__AVR__)
+#define RA8875_LINEBUF_SIZE 32 ///< Bytes per bulk pixel SPI transfer
+#else
+#define RA8875_LINEBUF_SIZE 256 ///< Bytes per bulk pixel SPI transfer
+#endif
+#endif
+
+#ifndef RA8875_RLE_FILL_MIN
+#define RA8875_RLE_FILL_MIN 32 ///< Min RLE run drawn by the fill engine
+#endif
+
+#ifndef RA8875_MONO_BTE_MIN
+#define RA8875_MONO_BTE_MIN 10 ///< Min transparent 1-bit bitmap for the BTE
+#endif
+
+#ifndef RA8875_JPEG_STATIC
+#define RA8875_JPEG_STATIC 0 ///< Set to 1 to keep drawJPEG()'s 3KB state static
+#endif
+
 // Sizes!
 
 /**************************************************************************/
@@ -88,6 +136,17 @@ enum RA8875sizes {
   RA8875_800x480  /*!< 800x480 Pixel Display */
 };
 
+/**************************************************************************/
+/*!
+ @enum RA8875bteDir BTE Move Directions
+ */
+/**************************************************************************/
+enum RA8875bteDir {
+  RA8875_BTE_AUTO,    /*!< Pick the direction that is safe for overlaps */
+  RA8875_BTE_FORWARD, /*!< Copy from the top-left corner */
+  RA8875_BTE_BACKWARD /*!< Copy from the bottom-right corner */
+};
+
 /**************************************************************************/
 /*!
  @struct Point
@@ -130,6 +189,86 @@ typedef struct // Matrix
   int32_t An, Bn, Cn, Dn, En, Fn, Divider;
 } tsMatrix_t;
 
+/**************************************************************************/
+/*!
+ @struct tsSpiStats_t
+ SPI Traffic Counters (only updated after enableSpiStats(true))
+
+ @var tsSpiStats_t::transactions
+ Number of times the SPI bus was claimed
+ @var tsSpiStats_t::frames
+ Number of CS low/high frames, each one command, data or status cycle
+ @var tsSpiStats_t::bytes
+ Number of bytes transferred, including the cycle type bytes
+ */
+/**************************************************************************/
+typedef struct {
+  uint32_t transactions, frames, bytes;
+} tsSpiStats_t;
+
+/**************************************************************************/
+/*!
+ @struct tsAsset_t
+ Asset Cache Slot
+
+ @var tsAsset_t::id
+ The asset ID
+ @var tsAsset_t::x
+ The x location in the cache area
+ @var tsAsset_t::y
+ The y location in the cache area
+ @var tsAsset_t::w
+ The asset width, 0 for a free slot
+ @var tsAsset_t::h
+ The asset height
+ @var tsAsset_t::used
+ When the asset was last used, for LRU eviction
+ */
+/**************************************************************************/
+typedef struct {
+  uint16_t id;
+  int16_t x, y, w, h;
+  uint32_t used;
+} tsAsset_t;
+
+/**************************************************************************/
+/*!
+ @struct tsImage_t
+ Clipped Destination of an Image being Streamed
+
+ @var tsImage_t::x
+ The screen x location of the first visible pixel
+ @var tsImage_t::y
+ The screen y location of the first visible pixel
+ @var tsImage_t::sx
+ The image column of the first visible pixel
+ @var tsImage_t::sy
+ The image row of the first visible pixel
+ @var tsImage_t::w
+ The visible width
+ @var tsImage_t::h
+ The visible height
+ @var tsImage_t::row
+ The image row the controller writes next
+ @var tsImage_t::col
+ The image column the controller writes next
+ @var tsImage_t::bandRow
+ The image row of the top of the band of blocks the active window is set
+ to, -1 if none
+ @var tsImage_t::bandH
+ The visible height of the band of blocks
+ @var tsImage_t::bandCol
+ The image column the controller writes next in the band, -1 if unknown
+ */
+/**************************************************************************/
+typedef struct {
+  int16_t x, y, sx, sy, w, h;
+  int16_t row, col;
+  int16_t bandRow, bandH, bandCol;
+} tsImage_t;
+
+struct tsJpeg; ///< JPEG decoder state, see drawJPEG()
+
 /**************************************************************************/
 /*!
  @brief  Class that stores state and functions for interacting with
@@ -145,6 +284,12 @@ class Adafruit_RA8875 : public Adafruit_GFX {
   void displayOn(boolean on);
   void sleep(boolean sleep);
 
+  /* Color depth */
+  boolean setColorDepth(uint8_t bpp);
+  uint8_t getColorDepth(void);
+  void setDither(boolean on);
+  static uint8_t color332(uint16_t color);
+
   /* Text functions */
   void textMode(void);
   void textSetCursor(uint16_t x, uint16_t y);
@@ -157,6 +302,23 @@ class Adafruit_RA8875 : public Adafruit_GFX {
   /* Graphics functions */
   void graphicsMode(void);
   void setXY(uint16_t x, uint16_t y);
+  boolean setClipRect(int16_t x, int16_t y, int16_t w, int16_t h);
+  void resetClip(void);
+
+  /* Memory read-back */
+  boolean readPixels(int16_t x, int16_t y, int16_t w, int16_t h,
+                     uint16_t* buf);
+  int16_t screenshot(Print& out, int16_t row = 0, int16_t rows = 0x7FFF);
+
+  /* Image streaming */
+  boolean drawBMP(Stream& in, int16_t x, int16_t y);
+  boolean drawRaw565(Stream& in, int16_t x, int16_t y, int16_t w, int16_t h,
+                     boolean bigEndian = false);
+  boolean drawRLEBitmap(int16_t x, int16_t y, const uint8_t data[],
+                        uint32_t len);
+  boolean drawRLEBitmap(int16_t x, int16_t y, uint8_t* data, uint32_t len);
+  boolean drawQOI(Stream& in, int16_t x, int16_t y);
+  boolean drawJPEG(Stream& in, int16_t x, int16_t y);
   void pushPixels(uint32_t num, uint16_t p);
   void fillRect(void);
 
@@ -166,6 +328,43 @@ class Adafruit_RA8875 : public Adafruit_GFX {
   void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
 
+  /* Batched drawing (override Adafruit_GFX prototypes) */
+  void startWrite(void);
+  void writePixel(int16_t x, int16_t y, uint16_t color);
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void endWrite(void);
+
+  /* Windowed bitmap streaming (override Adafruit_GFX prototypes) */
+  using Adafruit_GFX::drawGrayscaleBitmap;
+  using Adafruit_GFX::drawRGBBitmap;
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w,
+                     int16_t h);
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w,
+                     int16_t h);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg);
+  void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h,
+                  uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg);
+  void drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                   int16_t h, uint16_t color);
+  void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                           int16_t w, int16_t h);
+  void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w,
+                           int16_t h);
+
+  /* BTE color expansion */
+  using Adafruit_GFX::drawChar;
+  void drawMonoBitmap(int16_t x, int16_t y, int16_t w, int16_t h,
+                      const uint8_t* bits, uint16_t fg, uint16_t bg);
+  void drawMonoBitmap(int16_t x, int16_t y, int16_t w, int16_t h,
+                      const uint8_t* bits, uint16_t fg);
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size_x, uint8_t size_y);
+
   /* HW accelerated wrapper functions (override Adafruit_GFX prototypes) */
   void fillScreen(uint16_t color);
   void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
@@ -196,6 +395,51 @@ class Adafruit_RA8875 : public Adafruit_GFX {
   void scrollX(int16_t dist);
   void scrollY(int16_t dist);
 
+  /* Layers */
+  boolean enableLayers(boolean on);
+  void setLayer(uint8_t layer);
+  uint8_t getLayer(void);
+  void setDisplayLayer(uint8_t layer);
+  uint8_t getDisplayLayer(void);
+  boolean setDoubleBuffer(boolean on);
+  void setVsyncPin(int8_t pin);
+  void present(boolean preserve = false);
+
+  /* Block Transfer Engine */
+  void bteMove(int16_t sx, int16_t sy, int16_t dx, int16_t dy, int16_t w,
+               int16_t h, enum RA8875bteDir dir = RA8875_BTE_AUTO);
+  void bteMove(uint8_t srcLayer, int16_t sx, int16_t sy, uint8_t dstLayer,
+               int16_t dx, int16_t dy, int16_t w, int16_t h,
+               enum RA8875bteDir dir = RA8875_BTE_AUTO);
+  void bteRop(int16_t sx, int16_t sy, int16_t dx, int16_t dy, int16_t w,
+              int16_t h, uint8_t rop, enum RA8875bteDir dir = RA8875_BTE_AUTO);
+  void bteRop(uint8_t srcLayer, int16_t sx, int16_t sy, uint8_t dstLayer,
+              int16_t dx, int16_t dy, int16_t w, int16_t h, uint8_t rop,
+              enum RA8875bteDir dir = RA8875_BTE_AUTO);
+  void bteWrite(int16_t x, int16_t y, int16_t w, int16_t h,
+                const uint16_t* pixels, uint8_t rop);
+  void bteMoveTransparent(int16_t sx, int16_t sy, int16_t dx, int16_t dy,
+                          int16_t w, int16_t h, uint16_t key);
+  void bteMoveTransparent(uint8_t srcLayer, int16_t sx, int16_t sy,
+                          uint8_t dstLayer, int16_t dx, int16_t dy, int16_t w,
+                          int16_t h, uint16_t key);
+  void bteInvert(int16_t x, int16_t y, int16_t w, int16_t h);
+  void drawXorRect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  /* Asset cache in off-screen display memory */
+  boolean setAssetCache(uint8_t layer, int16_t x, int16_t y, int16_t w,
+                        int16_t h);
+  void clearAssetCache(void);
+  boolean allocAsset(uint16_t id, int16_t w, int16_t h, int16_t* x,
+                     int16_t* y);
+  boolean cacheAsset(uint16_t id, const uint16_t bitmap[], int16_t w,
+                     int16_t h);
+  boolean cacheAsset(uint16_t id, uint16_t* bitmap, int16_t w, int16_t h);
+  boolean isCached(uint16_t id);
+  void evictAsset(uint16_t id);
+  boolean drawCached(uint16_t id, int16_t x, int16_t y);
+  boolean drawCached(uint16_t id, int16_t x, int16_t y, uint16_t key);
+
   /* Backlight */
   void GPIOX(boolean on);
   void PWM1config(boolean on, uint8_t clock);
@@ -222,12 +466,33 @@ class Adafruit_RA8875 : public Adafruit_GFX {
 
   /* Low level access */
   void writeReg(uint8_t reg, uint8_t val);
+  void writeRegs(const uint8_t* regs, uint8_t count);
   uint8_t readReg(uint8_t reg);
   void writeData(uint8_t d);
   uint8_t readData(void);
   void writeCommand(uint8_t d);
   uint8_t readStatus(void);
   boolean waitPoll(uint8_t r, uint8_t f);
+  boolean waitBusy(uint8_t mask);
+  void setPollTimeout(uint16_t ms);
+  void setPollBackoff(uint16_t minUs, uint16_t maxUs);
+  void setWaitPin(int8_t pin);
+  void setIntPin(int8_t pin);
+  uint32_t pollCount(void);
+  void clearPollCount(void);
+  boolean timedOut(void);
+  void enableSpiStats(boolean on);
+  tsSpiStats_t spiStats(void);
+  void clearSpiStats(void);
+  void setAsync(boolean on);
+  boolean sync(void);
+  boolean isBusy(void);
+  void enableRegisterCache(boolean on);
+  void enableWriteCache(boolean on);
+  void invalidateRegisterCache(void);
+  void syncRegisterCache(void);
+  uint32_t skippedWrites(void);
+  void clearSkippedWrites(void);
   uint16_t width(void);
   uint16_t height(void);
   void setRotation(int8_t rotation);
@@ -268,6 +533,21 @@ class Adafruit_RA8875 : public Adafruit_GFX {
   void PLLinit(void);
   void initialize(void);
 
+  /* Register burst helpers */
+  void beginBurst(void);
+  void endBurst(void);
+  void writeReg16(uint8_t reg, uint16_t val);
+  void writeColor(uint8_t reg, uint16_t color);
+  int8_t shadowIndex(uint8_t reg);
+  uint8_t readShadowReg(uint8_t reg);
+  void writeRegCached(uint8_t reg, uint8_t val);
+  void trackWrite(uint8_t reg, uint8_t val);
+  boolean waitEngine(uint8_t regname, uint8_t waitflag);
+  boolean pollHelper(int16_t regname, uint8_t mask);
+  boolean pollDelay(unsigned long start, uint16_t& backoff);
+  boolean vsyncHelper(uint8_t level);
+  int8_t cacheSlot(uint8_t reg);
+
   /* GFX Helper Functions */
   void circleHelper(int16_t x, int16_t y, int16_t r, uint16_t color,
                     bool filled);
@@ -282,10 +562,65 @@ class Adafruit_RA8875 : public Adafruit_GFX {
                    bool filled);
   void roundRectHelper(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
                        uint16_t color, bool filled);
+  void rgbBitmapHelper(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w,
+                       int16_t h, bool progmem);
+  void monoBitmapHelper(int16_t x, int16_t y, const uint8_t* bits,
+                        uint32_t bitOffset, uint16_t stride, int16_t w,
+                        int16_t h, uint16_t color, uint16_t bg,
+                        bool transparent, bool progmem, bool xbm);
+  void monoRunsHelper(int16_t x, int16_t y, const uint8_t* bits,
+                      uint32_t bitOffset, uint16_t stride, int16_t w,
+                      int16_t h, uint16_t color, bool progmem, bool xbm);
+  boolean jpegHelper(Stream& in, struct tsJpeg& j, int16_t x, int16_t y);
+  boolean rleBitmapHelper(int16_t x, int16_t y, const uint8_t* data,
+                          uint32_t len, bool progmem);
+  void grayBitmapHelper(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w,
+                        int16_t h, bool progmem);
+
+  /* Windowed streaming */
+  bool clipRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h, int16_t& sx,
+                int16_t& sy);
+  void streamBegin(int16_t x, int16_t y, int16_t w, int16_t h,
+                   bool read = false);
+  void streamPixel(uint16_t color);
+  void streamEnd(void);
+  void setActiveWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  void resetActiveWindow(void);
+  void flushRun(void);
+  boolean finishEngine(uint8_t regname, uint8_t waitflag);
+  boolean drawCachedHelper(uint16_t id, int16_t x, int16_t y, uint16_t key,
+                           bool transparent);
+  boolean cacheHelper(uint16_t id, const uint16_t* bitmap, int16_t w,
+                      int16_t h, bool progmem);
+  int8_t findAsset(uint16_t id);
+  int8_t allocHelper(uint16_t id, int16_t w, int16_t h);
+  bool assetFits(int16_t x, int16_t y, int16_t w, int16_t h);
+  void bteStart(uint8_t srcLayer, int16_t sx, int16_t sy, uint8_t dstLayer,
+                int16_t dx, int16_t dy, int16_t w, int16_t h, uint8_t op,
+                uint8_t rop);
+  void writePixelData(const uint16_t* p, uint16_t color, uint32_t num);
+  void readPixelData(uint16_t* p, uint32_t num);
+  bool imageBegin(tsImage_t& img, int16_t x, int16_t y, int16_t w, int16_t h);
+  void imagePixels(tsImage_t& img, int16_t row, int16_t col,
+                   const uint16_t* p, uint16_t color, int16_t num);
+  void imageFill(tsImage_t& img, int16_t row, int16_t col, int16_t w,
+                 int16_t h, uint16_t color);
+  void imageBlock(tsImage_t& img, int16_t row, int16_t col, int16_t w,
+                  int16_t h, const uint16_t* p);
+  void imageEnd(tsImage_t& img);
+  boolean imageRows(Stream& in, tsImage_t& img, int16_t w, int16_t h,
+                    uint8_t format, uint32_t stride, bool bottomUp);
+  void ditherStart(int16_t x, int16_t y, uint32_t w);
+  uint8_t pixel332(uint16_t color);
+  void beginFrame(uint8_t cycle);
+  void endFrame(void);
+  uint8_t spiWrite(uint8_t d);
 
   /* Rotation Functions */
-  int16_t applyRotationX(int16_t x);
-  int16_t applyRotationY(int16_t y);
+  void applyRotation(int16_t& x, int16_t& y);
+  uint8_t rotationDir(void);
+  void logicalOffset(int16_t i, int16_t j, int16_t& lx, int16_t& ly);
+  void rotationHelper(void);
 
   void swap(int16_t& x, int16_t& y) {
     int16_t temp = x;
@@ -297,7 +632,41 @@ class Adafruit_RA8875 : public Adafruit_GFX {
   uint16_t _width, _height;
   uint8_t _textScale;
   uint8_t _rotation;
+  boolean _initialized;
+  uint8_t _layer, _displayLayer;
+  uint8_t _bpp;
+  boolean _dither;
+  int16_t _ditherX, _ditherY, _ditherX0, _ditherX1;
+  int16_t _clipX0, _clipY0, _clipX1, _clipY1;
+  int8_t _vsyncPin;
+  boolean _doubleBuffer;
+  uint8_t _cacheLayer;
+  int16_t _cacheX, _cacheY, _cacheW, _cacheH;
+  tsAsset_t _assets[RA8875_ASSET_SLOTS];
+  uint32_t _assetTick;
   uint8_t _voffset;
+  uint8_t _burstDepth;
+  boolean _shadowEnabled;
+  boolean _writeCache;
+  uint8_t _curReg;
+  uint8_t _shadowValid;
+  uint8_t _shadow[RA8875_SHADOW_REGS];
+  uint32_t _cachedValid;
+  uint8_t _cached[RA8875_CACHED_REGS];
+  int8_t _textTransparent;
+  uint32_t _skippedWrites;
+  boolean _async;
+  uint8_t _busyReg, _busyFlag;
+  int8_t _waitPin, _intPin;
+  uint16_t _pollTimeout;
+  uint16_t _pollBackoffMin, _pollBackoffMax;
+  uint32_t _pollCount;
+  boolean _timedOut;
+  tsSpiStats_t _spiStats;
+  boolean _spiStatsOn;
+  uint16_t _run[RA8875_RUN_SIZE];
+  int16_t _runX, _runY;
+  uint8_t _runLen;
   enum RA8875sizes _size;
 };
 
@@ -327,6 +696,11 @@ class Adafruit_RA8875 : public Adafruit_GFX {
 
 #define RA8875_MRWC 0x02 ///< See datasheet
 
+#define RA8875_STSR_MEMBUSY 0x80 ///< Memory read/write busy (status register)
+#define RA8875_STSR_BTEBUSY 0x40 ///< BTE busy (status register)
+#define RA8875_STSR_TOUCH 0x20   ///< Touch panel event (status register)
+#define RA8875_STSR_SLEEP 0x10   ///< Sleep mode (status register)
+
 #define RA8875_GPIOX 0xC7 ///< See datasheet
 
 #define RA8875_PLLC1 0x88         ///< See datasheet
@@ -343,11 +717,12 @@ class Adafruit_RA8875 : public Adafruit_GFX {
 #define RA8875_PLLC2_DIV64 0x06  ///< See datasheet
 #define RA8875_PLLC2_DIV128 0x07 ///< See datasheet
 
-#define RA8875_SYSR 0x10       ///< See datasheet
-#define RA8875_SYSR_8BPP 0x00  ///< See datasheet
-#define RA8875_SYSR_16BPP 0x0C ///< See datasheet
-#define RA8875_SYSR_MCU8 0x00  ///< See datasheet
-#define RA8875_SYSR_MCU16 0x03 ///< See datasheet
+#define RA8875_SYSR 0x10           ///< See datasheet
+#define RA8875_SYSR_8BPP 0x00      ///< See datasheet
+#define RA8875_SYSR_16BPP 0x0C     ///< See datasheet
+#define RA8875_SYSR_COLORMASK 0x0C ///< Color depth bits
+#define RA8875_SYSR_MCU8 0x00      ///< See datasheet
+#define RA8875_SYSR_MCU16 0x03     ///< See datasheet
 
 #define RA8875_PCSR 0x04       ///< See datasheet
 #define RA8875_PCSR_PDATR 0x00 ///< See datasheet
@@ -424,12 +799,32 @@ class Adafruit_RA8875 : public Adafruit_GFX {
 #define RA8875_MWCR0_TDLR 0x08    ///< Top->Down then Left->Right
 #define RA8875_MWCR0_DTLR 0x0C    ///< Down->Top then Left->Right
 
+#define RA8875_MWCR1 0x41       ///< See datasheet
+#define RA8875_MWCR1_LAYER 0x01 ///< See datasheet
+
+#define RA8875_DPCR 0x20         ///< See datasheet
+#define RA8875_DPCR_LAYERS2 0x80 ///< See datasheet
+#define RA8875_DPCR_HDIR 0x08    ///< Panel scans columns right to left
+#define RA8875_DPCR_VDIR 0x04    ///< Panel scans rows bottom to top
+
+#define RA8875_LTPR0 0x52            ///< See datasheet
+#define RA8875_LTPR0_SCROLLMASK 0xC0 ///< Bitmask for Scroll Mode
+#define RA8875_LTPR0_DISPMASK 0x07   ///< Bitmask for Layer Display Mode
+#define RA8875_LTPR0_LAYER1 0x00     ///< Only layer 1 is visible
+#define RA8875_LTPR0_LAYER2 0x01     ///< Only layer 2 is visible
+
 #define RA8875_BTCR 0x44  ///< See datasheet
 #define RA8875_CURH0 0x46 ///< See datasheet
 #define RA8875_CURH1 0x47 ///< See datasheet
 #define RA8875_CURV0 0x48 ///< See datasheet
 #define RA8875_CURV1 0x49 ///< See datasheet
 
+#define RA8875_MRCD 0x45   ///< Memory read cursor direction
+#define RA8875_RCURH0 0x4A ///< See datasheet
+#define RA8875_RCURH1 0x4B ///< See datasheet
+#define RA8875_RCURV0 0x4C ///< See datasheet
+#define RA8875_RCURV1 0x4D ///< See datasheet
+
 #define RA8875_P1CR 0x8A         ///< See datasheet
 #define RA8875_P1CR_ENABLE 0x80  ///< See datasheet
 #define RA8875_P1CR_DISABLE 0x00 ///< See datasheet
@@ -518,4 +913,51 @@ class Adafruit_RA8875 : public Adafruit_GFX {
 #define RA8875_SCROLL_LAYER2 0x80 ///< See datasheet
 #define RA8875_SCROLL_BUFFER 0xC0 ///< See datasheet
 
+#define RA8875_BECR0 0x50            ///< See datasheet
+#define RA8875_BECR0_ENABLE 0x80     ///< See datasheet
+#define RA8875_BECR1 0x51            ///< See datasheet
+#define RA8875_HSBE0 0x54            ///< See datasheet
+#define RA8875_HSBE1 0x55            ///< See datasheet
+#define RA8875_VSBE0 0x56            ///< See datasheet
+#define RA8875_VSBE1 0x57            ///< See datasheet
+#define RA8875_VSBE1_LAYER 0x80      ///< See datasheet
+#define RA8875_HDBE0 0x58            ///< See datasheet
+#define RA8875_HDBE1 0x59            ///< See datasheet
+#define RA8875_VDBE0 0x5A            ///< See datasheet
+#define RA8875_VDBE1 0x5B            ///< See datasheet
+#define RA8875_VDBE1_LAYER 0x80      ///< See datasheet
+#define RA8875_BEWR0 0x5C            ///< See datasheet
+#define RA8875_BEWR1 0x5D            ///< See datasheet
+#define RA8875_BEHR0 0x5E            ///< See datasheet
+#define RA8875_BEHR1 0x5F            ///< See datasheet
+#define RA8875_BTE_WRITE 0x00        ///< See datasheet
+#define RA8875_BTE_MOVE_POS 0x02     ///< See datasheet
+#define RA8875_BTE_MOVE_NEG 0x03     ///< See datasheet
+#define RA8875_BTE_MOVE_TRANS 0x05   ///< See datasheet
+#define RA8875_BTE_EXPAND 0x08       ///< See datasheet
+#define RA8875_BTE_EXPAND_TRANS 0x09 ///< See datasheet
+#define RA8875_BTE_EXPAND_MSB 0x07   ///< Expansion starts at bit 7 (8-bit MCU)
+
+#define RA8875_BTE_ROP_0 0x00           ///< Raster operation: 0 (black)
+#define RA8875_BTE_ROP_NOR 0x01         ///< Raster operation: ~(S | D)
+#define RA8875_BTE_ROP_NOT_S_AND_D 0x02 ///< Raster operation: ~S & D
+#define RA8875_BTE_ROP_NOT_S 0x03       ///< Raster operation: ~S
+#define RA8875_BTE_ROP_S_AND_NOT_D 0x04 ///< Raster operation: S & ~D
+#define RA8875_BTE_ROP_NOT_D 0x05       ///< Raster operation: ~D
+#define RA8875_BTE_ROP_XOR 0x06         ///< Raster operation: S ^ D
+#define RA8875_BTE_ROP_NAND 0x07        ///< Raster operation: ~(S & D)
+#define RA8875_BTE_ROP_AND 0x08         ///< Raster operation: S & D
+#define RA8875_BTE_ROP_XNOR 0x09        ///< Raster operation: ~(S ^ D)
+#define RA8875_BTE_ROP_D 0x0A           ///< Raster operation: D
+#define RA8875_BTE_ROP_NOT_S_OR_D 0x0B  ///< Raster operation: ~S | D
+#define RA8875_BTE_ROP_S 0x0C           ///< Raster operation: S
+#define RA8875_BTE_ROP_S_OR_NOT_D 0x0D  ///< Raster operation: S | ~D
+#define RA8875_BTE_ROP_OR 0x0E          ///< Raster operation: S | D
+#define RA8875_BTE_ROP_1 0x0F           ///< Raster operation: 1 (white)
+
+#define RA8875_LAYER1 0 ///< First display layer
+#define RA8875_LAYER2 1 ///< Second display layer
+
+#define RA8875_DISPLAY_RAM 786432UL ///< Bytes of display memory (768KB)
+
 #endif
@@ -0,0 +1,1435 @@
+/*!
+ * @file     Adafruit_RA8875_Image.cpp
+ *
+ * Image streaming for the Adafruit RA8875 TFT driver. Images are decoded
+ * from any Stream, e.g. a File on an SD card, straight into display memory
+ * through a windowed memory write.
+ *
+ * Adafruit invests time and resources providing this open
+ * source code, please support Adafruit and open-source hardware
+ * by purchasing products from Adafruit!
+ *
+ * BSD license, check license.txt for more information.
+ * All text above must be included in any redistribution.
+ *
+ */
+
+#include "Adafruit_RA8875.h"
+
+#define RA8875_IMG_RGB565LE 0 ///< 16-bit RGB565, low byte first
+#define RA8875_IMG_RGB565BE 1 ///< 16-bit RGB565, high byte first
+#define RA8875_IMG_RGB555LE 2 ///< 16-bit XRGB1555, low byte first
+#define RA8875_IMG_BGR888 3   ///< 24-bit, blue byte first
+
+/**************************************************************************/
+/*!
+      Read a little-endian 16-bit value from a byte buffer
+
+      @param p The buffer
+
+      @return The value
+*/
+/**************************************************************************/
+static uint16_t le16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+
+/**************************************************************************/
+/*!
+      Read a little-endian 32-bit value from a byte buffer
+
+      @param p The buffer
+
+      @return The value
+*/
+/**************************************************************************/
+static uint32_t le32(const uint8_t* p) {
+  return le16(p) | ((uint32_t)le16(p + 2) << 16);
+}
+
+/**************************************************************************/
+/*!
+      Read and drop bytes from a stream
+
+      @param in The stream
+      @param n  The number of bytes to drop
+
+      @return False if the stream ended first
+*/
+/**************************************************************************/
+static bool skipBytes(Stream& in, uint32_t n) {
+  uint8_t buf[32];
+  while (n) {
+    size_t len = (n < sizeof(buf)) ? n : sizeof(buf);
+    if (in.readBytes(buf, len) != len)
+      return false;
+    n -= len;
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+      Read one byte of an RLE image
+
+      @param p       The byte to read
+      @param progmem Whether p is in PROGMEM
+
+      @return The byte
+*/
+/**************************************************************************/
+static uint8_t rleByte(const uint8_t* p, bool progmem) {
+  return progmem ? pgm_read_byte(p) : *p;
+}
+
+/**************************************************************************/
+/*!
+    @struct tsReader_t
+    Buffered byte reader for the streaming decoders
+
+    @var tsReader_t::in
+    The stream to read
+    @var tsReader_t::buf
+    The bytes read ahead
+    @var tsReader_t::pos
+    The next byte in buf
+    @var tsReader_t::len
+    The number of bytes in buf
+    @var tsReader_t::eof
+    Set once a read ran past the end of the stream
+*/
+/**************************************************************************/
+typedef struct {
+  Stream* in;
+  uint8_t buf[32];
+  uint8_t pos, len;
+  bool eof;
+} tsReader_t;
+
+/**************************************************************************/
+/*!
+      Start reading a stream through a reader
+
+      @param r  The reader
+      @param in The stream
+*/
+/**************************************************************************/
+static void readerBegin(tsReader_t& r, Stream& in) {
+  r.in = &in;
+  r.pos = r.len = 0;
+  r.eof = false;
+}
+
+/**************************************************************************/
+/*!
+      Read one byte through a reader, refilling it in bulk when empty
+
+      @param r The reader
+
+      @return The byte, or 0 with r.eof set when the stream ended
+*/
+/**************************************************************************/
+static uint8_t readerByte(tsReader_t& r) {
+  if (r.pos == r.len) {
+    r.pos = 0;
+    r.len = r.in->readBytes(r.buf, sizeof(r.buf));
+    if (!r.len) {
+      r.eof = true;
+      return 0;
+    }
+  }
+  return r.buf[r.pos++];
+}
+
+/// Natural order index of each coefficient of a JPEG block, in zigzag order
+static const uint8_t jpegZigzag[64] = {
+    0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6,  7,  14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63};
+
+/// IDCT constant scaled by 2^13
+#define JPEG_FIX(x) ((int32_t)((x)*8192 + 0.5))
+
+/**************************************************************************/
+/*!
+    @struct tsHuffman_t
+    Canonical Huffman decoding table of a JPEG image
+
+    @var tsHuffman_t::maxcode
+    The largest code of each length, -1 if there are none
+    @var tsHuffman_t::mincode
+    The smallest code of each length
+    @var tsHuffman_t::valptr
+    The index in vals of the smallest code of each length
+    @var tsHuffman_t::vals
+    The symbols, in code order
+*/
+/**************************************************************************/
+typedef struct {
+  int32_t maxcode[16];
+  uint16_t mincode[16];
+  uint8_t valptr[16];
+  uint8_t vals[162];
+} tsHuffman_t;
+
+/**************************************************************************/
+/*!
+    @struct tsJpeg_t
+    Decoder state of a baseline JPEG image
+
+    @var tsJpeg_t::rd
+    The reader for the image stream
+    @var tsJpeg_t::acc
+    The entropy coded bits read ahead, most significant bit first
+    @var tsJpeg_t::nbits
+    The number of bits in acc
+    @var tsJpeg_t::marker
+    The marker that ended the entropy coded data, 0 if none yet
+    @var tsJpeg_t::restart
+    The restart interval in MCUs, 0 if not used
+    @var tsJpeg_t::qt
+    The quantization tables, in zigzag order
+    @var tsJpeg_t::huff
+    The Huffman tables, DC 0 and 1 then AC 0 and 1
+    @var tsJpeg_t::ncomp
+    The number of components, 1 or 3
+    @var tsJpeg_t::order
+    The components in scan order
+    @var tsJpeg_t::id
+    The identifier of each component
+    @var tsJpeg_t::hs
+    The horizontal sampling factor of each component
+    @var tsJpeg_t::vs
+    The vertical sampling factor of each component
+    @var tsJpeg_t::tq
+    The quantization table of each component
+    @var tsJpeg_t::td
+    The DC Huffman table of each component
+    @var tsJpeg_t::ta
+    The AC Huffman table of each component
+    @var tsJpeg_t::pred
+    The DC value of the previous block of each component
+    @var tsJpeg_t::coef
+    The coefficients of the current block
+    @var tsJpeg_t::plane
+    The samples of each component in the current MCU
+    @var tsJpeg_t::mcu
+    The RGB565 pixels of the current MCU
+*/
+/**************************************************************************/
+typedef struct tsJpeg {
+  tsReader_t rd;
+  uint32_t acc;
+  uint8_t nbits;
+  uint8_t marker;
+  uint16_t restart;
+  uint8_t qt[4][64];
+  tsHuffman_t huff[4];
+  uint8_t ncomp;
+  uint8_t order[3];
+  uint8_t id[3], hs[3], vs[3], tq[3], td[3], ta[3];
+  int16_t pred[3];
+  int32_t coef[64];
+  uint8_t plane[3][256];
+  uint16_t mcu[256];
+} tsJpeg_t;
+
+/**************************************************************************/
+/*!
+      Read a big-endian 16-bit value through a reader
+
+      @param r The reader
+
+      @return The value
+*/
+/**************************************************************************/
+static uint16_t jpegWord(tsReader_t& r) {
+  uint16_t v = readerByte(r) << 8;
+  return v | readerByte(r);
+}
+
+/**************************************************************************/
+/*!
+      Read one marker segment of a JPEG image, up to the start of scan
+
+      @param j The decoder state
+      @param m The marker code
+      @param w Set to the image width by a frame header
+      @param h Set to the image height by a frame header
+
+      @return False if the image is not a supported JPEG
+*/
+/**************************************************************************/
+static bool jpegSegment(tsJpeg_t& j, uint8_t m, uint16_t& w, uint16_t& h) {
+  int32_t len = (int32_t)jpegWord(j.rd) - 2;
+
+  switch (m) {
+    case 0xDB:
+      /* Quantization tables, 8-bit only */
+      while (len >= 65) {
+        uint8_t t = readerByte(j.rd);
+        if (t & 0xFC)
+          return false;
+        for (uint8_t k = 0; k < 64; k++)
+          j.qt[t][k] = readerByte(j.rd);
+        len -= 65;
+      }
+      break;
+    case 0xC4:
+      /* Huffman tables */
+      while (len >= 17) {
+        uint8_t t = readerByte(j.rd);
+        if (t & 0xEE)
+          return false;
+        tsHuffman_t& hf = j.huff[((t >> 3) & 2) | (t & 1)];
+        uint16_t total = 0, code = 0;
+        for (uint8_t l = 0; l < 16; l++) {
+          uint8_t n = readerByte(j.rd);
+          hf.valptr[l] = total;
+          hf.mincode[l] = code;
+          code += n;
+          total += n;
+          hf.maxcode[l] = n ? code - 1 : -1;
+          code <<= 1;
+          if (total > sizeof(hf.vals))
+            return false;
+        }
+        for (uint16_t i = 0; i < total; i++)
+          hf.vals[i] = readerByte(j.rd);
+        len -= 17 + total;
+      }
+      break;
+    case 0xC0:
+    case 0xC1:
+      /* Baseline or extended sequential frame, 8-bit only */
+      if ((len < 6) || (readerByte(j.rd) != 8))
+        return false;
+      h = jpegWord(j.rd);
+      w = jpegWord(j.rd);
+      j.ncomp = readerByte(j.rd);
+      len -= 6;
+      if (((j.ncomp != 1) && (j.ncomp != 3)) || (len < 3 * j.ncomp))
+        return false;
+      for (uint8_t c = 0; c < j.ncomp; c++) {
+        j.id[c] = readerByte(j.rd);
+        uint8_t s = readerByte(j.rd);
+        j.hs[c] = s >> 4;
+        j.vs[c] = s & 0x0F;
+        j.tq[c] = readerByte(j.rd) & 3;
+        if ((j.hs[c] < 1) || (j.hs[c] > 2) || (j.vs[c] < 1) || (j.vs[c] > 2))
+          return false;
+      }
+      len -= 3 * j.ncomp;
+      /* A single component scan has one block per MCU */
+      if (j.ncomp == 1)
+        j.hs[0] = j.vs[0] = 1;
+      break;
+    case 0xDD:
+      /* Restart interval */
+      if (len < 2)
+        return false;
+      j.restart = jpegWord(j.rd);
+      len -= 2;
+      break;
+    default:
+      /* Other frame types are progressive, lossless or arithmetic coded */
+      if (((m >= 0xC2) && (m <= 0xCF) && (m != 0xC4) && (m != 0xCC)) ||
+          (m == 0xD9))
+        return false;
+      break;
+  }
+
+  while (len-- > 0)
+    readerByte(j.rd);
+  return !j.rd.eof;
+}
+
+/**************************************************************************/
+/*!
+      Top up the bit reader of a JPEG image to at least 25 bits. Stuffed
+      zero bytes are dropped, and after a marker zero bits are fed in.
+
+      @param j The decoder state
+*/
+/**************************************************************************/
+static void jpegFill(tsJpeg_t& j) {
+  while (j.nbits <= 24) {
+    uint8_t b = 0;
+    if (!j.marker) {
+      b = readerByte(j.rd);
+      if (b == 0xFF) {
+        uint8_t m;
+        do
+          m = readerByte(j.rd);
+        while ((m == 0xFF) && !j.rd.eof);
+        if (m) {
+          j.marker = m;
+          b = 0;
+        }
+      }
+    }
+    j.acc |= (uint32_t)b << (24 - j.nbits);
+    j.nbits += 8;
+  }
+}
+
+/**************************************************************************/
+/*!
+      Decode one Huffman coded symbol of a JPEG image
+
+      @param j  The decoder state
+      @param hf The Huffman table
+
+      @return The symbol, or -1 if no code matched
+*/
+/**************************************************************************/
+static int16_t jpegHuffman(tsJpeg_t& j, const tsHuffman_t& hf) {
+  jpegFill(j);
+  uint16_t peek = j.acc >> 16;
+  for (uint8_t l = 0; l < 16; l++) {
+    int32_t code = peek >> (15 - l);
+    if (code <= hf.maxcode[l]) {
+      j.acc <<= l + 1;
+      j.nbits -= l + 1;
+      return hf.vals[hf.valptr[l] + code - hf.mincode[l]];
+    }
+  }
+  return -1;
+}
+
+/**************************************************************************/
+/*!
+      Read a coefficient value of a JPEG image
+
+      @param j The decoder state
+      @param s The number of bits in the value
+
+      @return The signed value
+*/
+/**************************************************************************/
+static int32_t jpegReceive(tsJpeg_t& j, uint8_t s) {
+  if (!s)
+    return 0;
+  jpegFill(j);
+  int32_t v = j.acc >> (32 - s);
+  j.acc <<= s;
+  j.nbits -= s;
+  /* Values with the top bit clear are negative */
+  if (v < (1L << (s - 1)))
+    v -= (1L << s) - 1;
+  return v;
+}
+
+/**************************************************************************/
+/*!
+      Skip to the next restart marker of a JPEG image and reset the decoder
+
+      @param j The decoder state
+*/
+/**************************************************************************/
+static void jpegRestart(tsJpeg_t& j) {
+  j.acc = 0;
+  j.nbits = 0;
+  while (!j.marker && !j.rd.eof) {
+    if (readerByte(j.rd) != 0xFF)
+      continue;
+    uint8_t m;
+    do
+      m = readerByte(j.rd);
+    while ((m == 0xFF) && !j.rd.eof);
+    j.marker = m;
+  }
+  j.marker = 0;
+  memset(j.pred, 0, sizeof(j.pred));
+}
+
+/**************************************************************************/
+/*!
+      Decode and dequantize one block of a JPEG image into j.coef
+
+      @param j The decoder state
+      @param c The component of the block
+
+      @return False if the data is corrupt
+*/
+/**************************************************************************/
+static bool jpegBlock(tsJpeg_t& j, uint8_t c) {
+  const uint8_t* q = j.qt[j.tq[c]];
+  memset(j.coef, 0, sizeof(j.coef));
+
+  int16_t s = jpegHuffman(j, j.huff[j.td[c]]);
+  if ((s < 0) || (s > 11))
+    return false;
+  j.pred[c] += jpegReceive(j, s);
+  j.coef[0] = (int32_t)j.pred[c] * q[0];
+
+  for (uint8_t k = 1; k < 64; k++) {
+    int16_t rs = jpegHuffman(j, j.huff[2 + j.ta[c]]);
+    if (rs < 0)
+      return false;
+    if (!(rs & 0x0F)) {
+      /* End of block, or a run of 16 zeros */
+      if (rs != 0xF0)
+        break;
+      k += 15;
+      continue;
+    }
+    k += rs >> 4;
+    if (k > 63)
+      return false;
+    j.coef[jpegZigzag[k]] = jpegReceive(j, rs & 0x0F) * q[k];
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+      One 8-point pass of the Loeffler, Ligtenberg and Moschytz IDCT. The
+      outputs are scaled up by 2^13.
+
+      @param s    The first input
+      @param step The distance between two inputs
+      @param o    The 8 outputs
+*/
+/**************************************************************************/
+static void jpegIdct8(const int32_t* s, uint8_t step, int32_t* o) {
+  /* Even part */
+  int32_t p = (s[2 * step] + s[6 * step]) * JPEG_FIX(0.541196100);
+  int32_t t2 = p - s[6 * step] * JPEG_FIX(1.847759065);
+  int32_t t3 = p + s[2 * step] * JPEG_FIX(0.765366865);
+  int32_t t0 = (s[0] + s[4 * step]) * 8192;
+  int32_t t1 = (s[0] - s[4 * step]) * 8192;
+  int32_t e0 = t0 + t3, e3 = t0 - t3, e1 = t1 + t2, e2 = t1 - t2;
+
+  /* Odd part */
+  int32_t a0 = s[7 * step], a1 = s[5 * step], a2 = s[3 * step], a3 = s[step];
+  int32_t z1 = a0 + a3, z2 = a1 + a2, z3 = a0 + a2, z4 = a1 + a3;
+  int32_t z5 = (z3 + z4) * JPEG_FIX(1.175875602);
+  a0 *= JPEG_FIX(0.298631336);
+  a1 *= JPEG_FIX(2.053119869);
+  a2 *= JPEG_FIX(3.072711026);
+  a3 *= JPEG_FIX(1.501321110);
+  z1 *= -JPEG_FIX(0.899976223);
+  z2 *= -JPEG_FIX(2.562915447);
+  z3 = z3 * -JPEG_FIX(1.961570560) + z5;
+  z4 = z4 * -JPEG_FIX(0.390180644) + z5;
+  a0 += z1 + z3;
+  a1 += z2 + z4;
+  a2 += z2 + z3;
+  a3 += z1 + z4;
+
+  o[0] = e0 + a3;
+  o[7] = e0 - a3;
+  o[1] = e1 + a2;
+  o[6] = e1 - a2;
+  o[2] = e2 + a1;
+  o[5] = e2 - a1;
+  o[3] = e3 + a0;
+  o[4] = e3 - a0;
+}
+
+/**************************************************************************/
+/*!
+      Clamp a value to a sample
+
+      @param v The value
+
+      @return v clamped to 0-255
+*/
+/**************************************************************************/
+static uint8_t jpegClamp(int32_t v) {
+  return (v < 0) ? 0 : (v > 255) ? 255 : v;
+}
+
+/**************************************************************************/
+/*!
+      Inverse DCT of j.coef into 8x8 samples, with the same fixed-point
+      scaling as the libjpeg integer IDCT. j.coef is used as workspace.
+
+      @param j      The decoder state
+      @param out    The top-left sample
+      @param stride The distance between two rows of samples
+*/
+/**************************************************************************/
+static void jpegIdct(tsJpeg_t& j, uint8_t* out, uint8_t stride) {
+  int32_t o[8];
+
+  /* Columns, keeping 2 extra bits of precision */
+  for (uint8_t i = 0; i < 8; i++) {
+    int32_t* c = &j.coef[i];
+    if (!c[8] && !c[16] && !c[24] && !c[32] && !c[40] && !c[48] && !c[56]) {
+      for (uint8_t k = 1; k < 8; k++)
+        c[k * 8] = c[0] * 4;
+      c[0] *= 4;
+      continue;
+    }
+    jpegIdct8(c, 8, o);
+    for (uint8_t k = 0; k < 8; k++)
+      c[k * 8] = (o[k] + (1L << 10)) >> 11;
+  }
+
+  /* Rows, removing the 2^13 scale, the 2 extra bits and the 8x gain */
+  for (uint8_t i = 0; i < 8; i++, out += stride) {
+    jpegIdct8(&j.coef[i * 8], 1, o);
+    for (uint8_t k = 0; k < 8; k++)
+      out[k] = jpegClamp(((o[k] + (1L << 17)) >> 18) + 128);
+  }
+}
+
+/**************************************************************************/
+/*!
+      Decode one MCU of a JPEG image into j.plane
+
+      @param j The decoder state
+
+      @return False if the data is corrupt
+*/
+/**************************************************************************/
+static bool jpegMCU(tsJpeg_t& j) {
+  for (uint8_t i = 0; i < j.ncomp; i++) {
+    uint8_t c = j.order[i];
+    uint8_t stride = j.hs[c] * 8;
+    for (uint8_t v = 0; v < j.vs[c]; v++) {
+      for (uint8_t u = 0; u < j.hs[c]; u++) {
+        if (!jpegBlock(j, c))
+          return false;
+        jpegIdct(j, &j.plane[c][v * 8 * stride + u * 8], stride);
+      }
+    }
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+      Convert part of the MCU in j.plane to RGB565 pixels in j.mcu, with
+      the JFIF YCbCr equations in 16.16 fixed point. Subsampled components
+      are repeated to fill the MCU.
+
+      @param j The decoder state
+      @param w The width to convert, also the row stride of j.mcu
+      @param h The height to convert
+*/
+/**************************************************************************/
+static void jpegColor(tsJpeg_t& j, int16_t w, int16_t h) {
+  uint8_t hmax = 1, vmax = 1;
+  for (uint8_t c = 0; c < j.ncomp; c++) {
+    if (j.hs[c] > hmax)
+      hmax = j.hs[c];
+    if (j.vs[c] > vmax)
+      vmax = j.vs[c];
+  }
+
+  uint16_t* p = j.mcu;
+  for (int16_t y = 0; y < h; y++) {
+    for (int16_t x = 0; x < w; x++) {
+      int32_t s[3];
+      for (uint8_t c = 0; c < j.ncomp; c++) {
+        uint8_t sx = (j.hs[c] < hmax) ? x >> 1 : x;
+        uint8_t sy = (j.vs[c] < vmax) ? y >> 1 : y;
+        s[c] = j.plane[c][sy * j.hs[c] * 8 + sx];
+      }
+      if (j.ncomp == 1) {
+        *p++ = ((s[0] & 0xF8) << 8) | ((s[0] & 0xFC) << 3) | (s[0] >> 3);
+        continue;
+      }
+      int32_t cb = s[1] - 128, cr = s[2] - 128;
+      uint8_t r = jpegClamp(s[0] + ((91881 * cr + 32768) >> 16));
+      uint8_t g =
+          jpegClamp(s[0] + ((-22554 * cb - 46802 * cr + 32768) >> 16));
+      uint8_t b = jpegClamp(s[0] + ((116130 * cb + 32768) >> 16));
+      *p++ = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+      Draws a BMP image read from a stream. 24-bit, 16-bit (XRGB1555) and
+      16-bit RGB565 (BI_BITFIELDS, as written by screenshot()) images are
+      supported, top-down or bottom-up. Reading stops after the last
+      visible row.
+
+      @param in The stream holding the BMP file, e.g. a File
+      @param x  The 0-based x location of the top-left corner
+      @param y  The 0-based y location of the top-left corner
+
+      @return False if the format is not supported or the data ran out
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawBMP(Stream& in, int16_t x, int16_t y) {
+  /* BITMAPFILEHEADER and the start of the info header */
+  uint8_t hdr[54];
+  if ((in.readBytes(hdr, sizeof(hdr)) != sizeof(hdr)) || (hdr[0] != 'B') ||
+      (hdr[1] != 'M'))
+    return false;
+
+  uint32_t offset = le32(&hdr[10]);
+  int32_t w = (int32_t)le32(&hdr[18]);
+  int32_t h = (int32_t)le32(&hdr[22]);
+  uint16_t depth = le16(&hdr[28]);
+  uint32_t compression = le32(&hdr[30]);
+  uint32_t pos = sizeof(hdr);
+  if ((le32(&hdr[14]) < 40) || (le16(&hdr[26]) != 1) || (w <= 0) ||
+      (w > 0x7FFF) || (h == 0) || (h < -0x7FFF) || (h > 0x7FFF))
+    return false;
+
+  /* A negative height marks a top-down image */
+  bool bottomUp = (h > 0);
+  if (h < 0)
+    h = -h;
+
+  uint8_t format;
+  if ((depth == 24) && (compression == 0)) {
+    format = RA8875_IMG_BGR888;
+  } else if ((depth == 16) && (compression == 0)) {
+    format = RA8875_IMG_RGB555LE;
+  } else if ((depth == 16) && (compression == 3)) {
+    /* Only the RGB565 channel masks are supported */
+    uint8_t masks[12];
+    if ((in.readBytes(masks, sizeof(masks)) != sizeof(masks)) ||
+        (le32(&masks[0]) != 0xF800) || (le32(&masks[4]) != 0x07E0) ||
+        (le32(&masks[8]) != 0x001F))
+      return false;
+    pos += sizeof(masks);
+    format = RA8875_IMG_RGB565LE;
+  } else {
+    return false;
+  }
+
+  if ((offset < pos) || !skipBytes(in, offset - pos))
+    return false;
+
+  tsImage_t img;
+  if (!imageBegin(img, x, y, w, h))
+    return true;
+
+  /* Rows are padded to whole 32-bit words */
+  uint32_t stride = ((uint32_t)w * (depth / 8) + 3) & ~3UL;
+  boolean ok = imageRows(in, img, w, h, format, stride, bottomUp);
+  imageEnd(img);
+  return ok;
+}
+
+/**************************************************************************/
+/*!
+      Draws a raw RGB565 image read from a stream, rows top to bottom
+      without padding. Reading stops after the last visible row.
+
+      @param in        The stream holding the pixel data, e.g. a File
+      @param x         The 0-based x location of the top-left corner
+      @param y         The 0-based y location of the top-left corner
+      @param w         The image width
+      @param h         The image height
+      @param bigEndian Whether each pixel is stored high byte first
+
+      @return False if the data ran out
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawRaw565(Stream& in, int16_t x, int16_t y,
+                                    int16_t w, int16_t h, boolean bigEndian) {
+  if ((w <= 0) || (h <= 0))
+    return false;
+
+  tsImage_t img;
+  if (!imageBegin(img, x, y, w, h))
+    return true;
+
+  boolean ok = imageRows(in, img, w, h,
+                         bigEndian ? RA8875_IMG_RGB565BE : RA8875_IMG_RGB565LE,
+                         (uint32_t)w * 2, false);
+  imageEnd(img);
+  return ok;
+}
+
+/**************************************************************************/
+/*!
+      Draws a PROGMEM-resident RLE image, as made by extras/rle_encode.py.
+      The image is a 7-byte header ('R', 'P', the width and height as
+      little-endian 16-bit values, the palette size minus one), the
+      little-endian RGB565 palette, then tokens of palette indices in row
+      order. A token byte with the top bit set is a run: its low 6 bits,
+      plus a second byte shifted up by 6 when bit 6 is set, hold the length
+      minus one, followed by the index. Otherwise the low 7 bits hold the
+      count minus one of the literal indices that follow.
+
+      @param x    The 0-based x location of the top-left corner
+      @param y    The 0-based y location of the top-left corner
+      @param data The image data (in PROGMEM)
+      @param len  The size of data in bytes, usually sizeof(data)
+
+      @return False if data is not an RLE image, is cut short or uses a
+              palette index past the palette
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawRLEBitmap(int16_t x, int16_t y,
+                                       const uint8_t data[], uint32_t len) {
+  return rleBitmapHelper(x, y, data, len, true);
+}
+
+/**************************************************************************/
+/*!
+      Draws a RAM-resident RLE image, see the PROGMEM version for the format
+
+      @param x    The 0-based x location of the top-left corner
+      @param y    The 0-based y location of the top-left corner
+      @param data The image data (in RAM)
+      @param len  The size of data in bytes
+
+      @return False if data is not an RLE image, is cut short or uses a
+              palette index past the palette
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawRLEBitmap(int16_t x, int16_t y, uint8_t* data,
+                                       uint32_t len) {
+  return rleBitmapHelper(x, y, data, len, false);
+}
+
+/**************************************************************************/
+/*!
+      Draws a QOI image read from a stream. RGB and RGBA images are
+      supported, the alpha channel is ignored. Decoding uses a fixed amount
+      of memory whatever the image size, and stops after the last visible
+      row.
+
+      @param in The stream holding the QOI file, e.g. a File
+      @param x  The 0-based x location of the top-left corner
+      @param y  The 0-based y location of the top-left corner
+
+      @return False if the stream is not a QOI image or the data ran out
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawQOI(Stream& in, int16_t x, int16_t y) {
+  uint8_t hdr[14];
+  if ((in.readBytes(hdr, sizeof(hdr)) != sizeof(hdr)) ||
+      (memcmp(hdr, "qoif", 4) != 0) || (hdr[12] < 3) || (hdr[12] > 4))
+    return false;
+
+  /* The sizes are big-endian */
+  uint32_t w = ((uint32_t)hdr[4] << 24) | ((uint32_t)hdr[5] << 16) |
+               ((uint32_t)hdr[6] << 8) | hdr[7];
+  uint32_t h = ((uint32_t)hdr[8] << 24) | ((uint32_t)hdr[9] << 16) |
+               ((uint32_t)hdr[10] << 8) | hdr[11];
+  if ((w == 0) || (w > 0x7FFF) || (h == 0) || (h > 0x7FFF))
+    return false;
+
+  tsImage_t img;
+  if (!imageBegin(img, x, y, w, h))
+    return true;
+
+  tsReader_t rd;
+  readerBegin(rd, in);
+  uint8_t index[64][4];
+  uint8_t px[4] = {0, 0, 0, 255};
+  uint8_t run = 0;
+  memset(index, 0, sizeof(index));
+
+  int16_t chunk = RA8875_LINEBUF_SIZE / 2;
+  uint16_t line[RA8875_LINEBUF_SIZE / 2];
+  int16_t n = 0, row = 0, col = 0;
+  while (row < img.sy + img.h) {
+    if (run) {
+      run--;
+    } else {
+      uint8_t b1 = readerByte(rd);
+      if (b1 == 0xFE) {
+        px[0] = readerByte(rd);
+        px[1] = readerByte(rd);
+        px[2] = readerByte(rd);
+      } else if (b1 == 0xFF) {
+        px[0] = readerByte(rd);
+        px[1] = readerByte(rd);
+        px[2] = readerByte(rd);
+        px[3] = readerByte(rd);
+      } else if ((b1 & 0xC0) == 0x00) {
+        memcpy(px, index[b1], 4);
+      } else if ((b1 & 0xC0) == 0x40) {
+        px[0] += ((b1 >> 4) & 3) - 2;
+        px[1] += ((b1 >> 2) & 3) - 2;
+        px[2] += (b1 & 3) - 2;
+      } else if ((b1 & 0xC0) == 0x80) {
+        uint8_t b2 = readerByte(rd);
+        int8_t dg = (b1 & 0x3F) - 32;
+        px[0] += dg - 8 + (b2 >> 4);
+        px[1] += dg;
+        px[2] += dg - 8 + (b2 & 0x0F);
+      } else {
+        run = b1 & 0x3F;
+      }
+      if (rd.eof)
+        break;
+      memcpy(index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) & 63], px,
+             4);
+    }
+
+    line[n++] = ((px[0] & 0xF8) << 8) | ((px[1] & 0xFC) << 3) | (px[2] >> 3);
+    col++;
+    if ((n == chunk) || (col == (int16_t)w)) {
+      imagePixels(img, row, col - n, line, 0, n);
+      n = 0;
+    }
+    if (col == (int16_t)w) {
+      col = 0;
+      row++;
+    }
+  }
+
+  imageEnd(img);
+  return !rd.eof;
+}
+
+/**************************************************************************/
+/*!
+      Draws a baseline JPEG image read from a stream. Grayscale and YCbCr
+      images with 4:4:4, 4:2:2 or 4:2:0 sampling are supported, with or
+      without restart markers. Each row of MCUs is sent through one active
+      window, so no frame buffer is needed. Decoding stops after the last
+      visible MCU row. Progressive images are not supported.
+
+      The decoder state takes about 3KB of RAM, allocated for the call. Set
+      RA8875_JPEG_STATIC to 1 to keep it in static storage instead, which
+      avoids the heap but is never freed and makes the call non-reentrant.
+
+      @param in The stream holding the JPEG file, e.g. a File
+      @param x  The 0-based x location of the top-left corner
+      @param y  The 0-based y location of the top-left corner
+
+      @return False if the format is not supported, the data is corrupt or
+              the decoder state cannot be allocated
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::drawJPEG(Stream& in, int16_t x, int16_t y) {
+#if RA8875_JPEG_STATIC
+  static tsJpeg_t j;
+  return jpegHelper(in, j, x, y);
+#else
+  tsJpeg_t* j = (tsJpeg_t*)malloc(sizeof(tsJpeg_t));
+  if (!j)
+    return false;
+  boolean ok = jpegHelper(in, *j, x, y);
+  free(j);
+  return ok;
+#endif
+}
+
+/**************************************************************************/
+/*!
+      Decode a JPEG image into display memory, see drawJPEG()
+
+      @param in The stream holding the JPEG file
+      @param j  The decoder state to use
+      @param x  The 0-based x location of the top-left corner
+      @param y  The 0-based y location of the top-left corner
+
+      @return False if the format is not supported or the data is corrupt
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::jpegHelper(Stream& in, tsJpeg_t& j, int16_t x,
+                                    int16_t y) {
+  memset(&j, 0, sizeof(j));
+  readerBegin(j.rd, in);
+  if ((readerByte(j.rd) != 0xFF) || (readerByte(j.rd) != 0xD8))
+    return false;
+
+  /* Read the segments up to the start of scan */
+  uint16_t w = 0, h = 0;
+  uint8_t m;
+  for (;;) {
+    if (readerByte(j.rd) != 0xFF)
+      return false;
+    do
+      m = readerByte(j.rd);
+    while ((m == 0xFF) && !j.rd.eof);
+    if (j.rd.eof)
+      return false;
+    if (m == 0xDA)
+      break;
+    if (!jpegSegment(j, m, w, h))
+      return false;
+  }
+
+  /* Only a single sequential scan holding all the components is supported */
+  if (!j.ncomp || (jpegWord(j.rd) != 6 + 2 * j.ncomp) ||
+      (readerByte(j.rd) != j.ncomp))
+    return false;
+  for (uint8_t i = 0; i < j.ncomp; i++) {
+    uint8_t id = readerByte(j.rd), t = readerByte(j.rd);
+    uint8_t c = 0;
+    while ((c < j.ncomp) && (j.id[c] != id))
+      c++;
+    if ((c == j.ncomp) || (t & 0xEE))
+      return false;
+    j.order[i] = c;
+    j.td[c] = t >> 4;
+    j.ta[c] = t & 1;
+  }
+  /* Spectral selection 0 to 63, no successive approximation */
+  if ((readerByte(j.rd) != 0) || (readerByte(j.rd) != 63) ||
+      (readerByte(j.rd) != 0))
+    return false;
+  if (j.rd.eof || !w || (w > 0x7FFF) || !h || (h > 0x7FFF))
+    return false;
+
+  tsImage_t img;
+  if (!imageBegin(img, x, y, w, h))
+    return true;
+
+  uint8_t hmax = 1, vmax = 1;
+  for (uint8_t c = 0; c < j.ncomp; c++) {
+    if (j.hs[c] > hmax)
+      hmax = j.hs[c];
+    if (j.vs[c] > vmax)
+      vmax = j.vs[c];
+  }
+  /* 32-bit positions, the last MCU can start within 15 pixels of 0x7FFF */
+  int32_t mw = hmax * 8, mh = vmax * 8;
+  uint16_t left = j.restart;
+  boolean ok = true;
+
+  for (int32_t my = 0; ok && (my < img.sy + img.h); my += mh) {
+    int32_t bh = ((int32_t)h - my < mh) ? (int32_t)h - my : mh;
+    for (int32_t mx = 0; mx < (int32_t)w; mx += mw) {
+      if (j.restart) {
+        if (!left) {
+          jpegRestart(j);
+          left = j.restart;
+        }
+        left--;
+      }
+      if (!jpegMCU(j)) {
+        ok = false;
+        break;
+      }
+      int32_t bw = ((int32_t)w - mx < mw) ? (int32_t)w - mx : mw;
+      if ((my + bh > img.sy) && (mx + bw > img.sx) &&
+          (mx < img.sx + img.w)) {
+        jpegColor(j, bw, bh);
+        imageBlock(img, my, mx, bw, bh, j.mcu);
+      }
+    }
+  }
+
+  imageEnd(img);
+  return ok && !j.rd.eof;
+}
+
+/**************************************************************************/
+/*!
+      Start streaming an image. The visible part is set up as one windowed
+      memory write, then the bus is released so the image data can come
+      from a device on the same SPI bus between the pushes.
+
+      @param img Set to the clipped destination
+      @param x   The 0-based x location of the top-left corner
+      @param y   The 0-based y location of the top-left corner
+      @param w   The image width
+      @param h   The image height
+
+      @return False if no part of the image is visible
+*/
+/**************************************************************************/
+bool Adafruit_RA8875::imageBegin(tsImage_t& img, int16_t x, int16_t y,
+                                 int16_t w, int16_t h) {
+  int16_t sx, sy;
+  if (!clipRect(x, y, w, h, sx, sy))
+    return false;
+
+  img.x = x;
+  img.y = y;
+  img.sx = sx;
+  img.sy = sy;
+  img.w = w;
+  img.h = h;
+  streamBegin(x, y, w, h);
+  img.row = sy;
+  img.col = sx;
+  img.bandRow = -1;
+  endFrame();
+  endBurst();
+  return true;
+}
+
+/**************************************************************************/
+/*!
+      Send a run of pixels from one row of an image started with
+      imageBegin(). Pixels outside the visible part are dropped. Runs that
+      continue where the controller left off go out without touching the
+      cursor, others move it first.
+
+      @param img   The destination set up by imageBegin()
+      @param row   The image row of the pixels
+      @param col   The image column of the first pixel
+      @param p     The RGB565 pixels, or NULL to repeat color
+      @param color The RGB565 color to repeat when p is NULL
+      @param num   The number of pixels
+*/
+/**************************************************************************/
+void Adafruit_RA8875::imagePixels(tsImage_t& img, int16_t row, int16_t col,
+                                  const uint16_t* p, uint16_t color,
+                                  int16_t num) {
+  if ((row < img.sy) || (row >= img.sy + img.h))
+    return;
+  if (col < img.sx) {
+    if (p)
+      p += img.sx - col;
+    num -= img.sx - col;
+    col = img.sx;
+  }
+  if (col + num > img.sx + img.w)
+    num = img.sx + img.w - col;
+  if (num <= 0)
+    return;
+
+  /* A block filled by imageFill() may still be drawing */
+  if (img.col < 0)
+    sync();
+
+  int16_t x = img.x + col - img.sx;
+  int16_t y = img.y + row - img.sy;
+  beginBurst();
+  if ((row != img.row) || (col != img.col)) {
+    int16_t cx = x, cy = y;
+    applyRotation(cx, cy);
+    writeReg16(RA8875_CURH0, cx);
+    writeReg16(RA8875_CURV0, cy);
+    writeCommand(RA8875_MRWC);
+  }
+  ditherStart(x, y, num);
+  beginFrame(RA8875_DATAWRITE);
+  writePixelData(p, color, num);
+  endFrame();
+  endBurst();
+
+  /* The active window wraps to the next row in the write direction */
+  img.row = row;
+  img.col = col + num;
+  if (img.col == img.sx + img.w) {
+    img.col = img.sx;
+    img.row++;
+  }
+}
+
+/**************************************************************************/
+/*!
+      Fill a block of an image started with imageBegin() with the drawing
+      engine. The block is clipped to the visible part, and the next pixels
+      sent move the cursor first.
+
+      @param img   The destination set up by imageBegin()
+      @param row   The image row of the top edge
+      @param col   The image column of the left edge
+      @param w     The block width
+      @param h     The block height
+      @param color The RGB565 fill color
+*/
+/**************************************************************************/
+void Adafruit_RA8875::imageFill(tsImage_t& img, int16_t row, int16_t col,
+                                int16_t w, int16_t h, uint16_t color) {
+  int16_t x1 = col + w - 1, y1 = row + h - 1;
+  if (col < img.sx)
+    col = img.sx;
+  if (row < img.sy)
+    row = img.sy;
+  if (x1 > img.sx + img.w - 1)
+    x1 = img.sx + img.w - 1;
+  if (y1 > img.sy + img.h - 1)
+    y1 = img.sy + img.h - 1;
+  if ((x1 < col) || (y1 < row))
+    return;
+
+  rectHelper(img.x + col - img.sx, img.y + row - img.sy, img.x + x1 - img.sx,
+             img.y + y1 - img.sy, color, true);
+  img.col = -1;
+}
+
+/**************************************************************************/
+/*!
+      Send a block of pixels of an image started with imageBegin(). Blocks
+      come in bands, such as a row of JPEG MCUs. The first block of a band
+      sets the active window to the visible part of the band and the write
+      direction to run down the columns, so at rotations 0 and 1 the blocks
+      of a band follow on from each other without moving the cursor.
+      Pixels outside the visible part are dropped. The
+      window stays set to the band, so blocks should not be mixed with runs.
+
+      @param img The destination set up by imageBegin()
+      @param row The image row of the top edge, the same for a whole band
+      @param col The image column of the left edge
+      @param w   The block width, also the row stride of p
+      @param h   The block height, the same for a whole band
+      @param p   The RGB565 pixels
+*/
+/**************************************************************************/
+void Adafruit_RA8875::imageBlock(tsImage_t& img, int16_t row, int16_t col,
+                                 int16_t w, int16_t h, const uint16_t* p) {
+  int16_t x0 = col, y0 = row, x1 = col + w, y1 = row + h;
+  if (x0 < img.sx)
+    x0 = img.sx;
+  if (y0 < img.sy)
+    y0 = img.sy;
+  if (x1 > img.sx + img.w)
+    x1 = img.sx + img.w;
+  if (y1 > img.sy + img.h)
+    y1 = img.sy + img.h;
+  if ((x1 <= x0) || (y1 <= y0))
+    return;
+
+  int16_t ch = y1 - y0;
+  int16_t top = img.y + y0 - img.sy;
+  beginBurst();
+  if ((y0 != img.bandRow) || (ch != img.bandH)) {
+    int16_t wx0 = img.x, wy0 = top, wx1 = img.x + img.w - 1,
+            wy1 = top + ch - 1;
+    applyRotation(wx0, wy0);
+    applyRotation(wx1, wy1);
+    if (wx0 > wx1)
+      swap(wx0, wx1);
+    if (wy0 > wy1)
+      swap(wy0, wy1);
+    sync();
+    setActiveWindow(wx0, wy0, wx1, wy1);
+    /* Columns run down a memory row at rotations 1 and 3 */
+    uint8_t dir = (_rotation & 1) ? RA8875_MWCR0_LRTD : RA8875_MWCR0_TDLR;
+    writeReg(RA8875_MWCR0,
+             (readShadowReg(RA8875_MWCR0) & ~RA8875_MWCR0_DIRMASK) | dir);
+    img.bandRow = y0;
+    img.bandH = ch;
+    img.bandCol = -1;
+  }
+
+  if (x0 != img.bandCol) {
+    int16_t cx = img.x + x0 - img.sx, cy = top;
+    applyRotation(cx, cy);
+    writeReg16(RA8875_CURH0, cx);
+    writeReg16(RA8875_CURV0, cy);
+    writeCommand(RA8875_MRWC);
+  }
+
+  /* Gather each column, dithered down the column */
+  uint16_t px[16];
+  beginFrame(RA8875_DATAWRITE);
+  for (int16_t c = x0; c < x1; c++) {
+    ditherStart(img.x + c - img.sx, top, 1);
+    const uint16_t* s = p + (int32_t)(y0 - row) * w + (c - col);
+    for (int16_t r = 0; r < ch;) {
+      uint8_t n = (ch - r < 16) ? ch - r : 16;
+      for (uint8_t k = 0; k < n; k++, s += w)
+        px[k] = *s;
+      writePixelData(px, 0, n);
+      r += n;
+    }
+  }
+  endFrame();
+  endBurst();
+  img.bandCol = x1;
+  img.col = -1;
+}
+
+/**************************************************************************/
+/*!
+      Finish an image started with imageBegin()
+
+      @param img The destination set up by imageBegin()
+*/
+/**************************************************************************/
+void Adafruit_RA8875::imageEnd(tsImage_t& img) {
+  (void)img;
+  resetActiveWindow();
+}
+
+/**************************************************************************/
+/*!
+      Read rows of uncompressed pixels from a stream and send the visible
+      part. Each row is read and sent in line buffer sized chunks, with the
+      bus released between them.
+
+      @param in       The stream, positioned at the first row
+      @param img      The destination set up by imageBegin()
+      @param w        The image width
+      @param h        The image height
+      @param format   The pixel format (RA8875_IMG_*)
+      @param stride   The number of bytes per row in the stream
+      @param bottomUp Whether the stream holds the last row first
+
+      @return False if the stream ended early
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::imageRows(Stream& in, tsImage_t& img, int16_t w,
+                                   int16_t h, uint8_t format, uint32_t stride,
+                                   bool bottomUp) {
+  uint8_t bpp = (format == RA8875_IMG_BGR888) ? 3 : 2;
+  int16_t chunk = RA8875_LINEBUF_SIZE / bpp;
+  int16_t end = img.sx + img.w;
+  uint8_t buf[RA8875_LINEBUF_SIZE];
+  uint16_t px[RA8875_LINEBUF_SIZE / 2];
+  (void)w;
+
+  for (int16_t r = 0; r < h; r++) {
+    int16_t row = bottomUp ? h - 1 - r : r;
+    if (bottomUp ? (row < img.sy) : (row >= img.sy + img.h))
+      break;
+    if ((row < img.sy) || (row >= img.sy + img.h)) {
+      if (!skipBytes(in, stride))
+        return false;
+      continue;
+    }
+
+    if (!skipBytes(in, (uint32_t)img.sx * bpp))
+      return false;
+    for (int16_t col = img.sx; col < end; col += chunk) {
+      int16_t n = end - col;
+      if (n > chunk)
+        n = chunk;
+      if (in.readBytes(buf, n * bpp) != (size_t)(n * bpp))
+        return false;
+
+      const uint8_t* b = buf;
+      for (int16_t i = 0; i < n; i++, b += bpp) {
+        switch (format) {
+          case RA8875_IMG_RGB565LE:
+            px[i] = b[0] | (b[1] << 8);
+            break;
+          case RA8875_IMG_RGB565BE:
+            px[i] = (b[0] << 8) | b[1];
+            break;
+          case RA8875_IMG_RGB555LE: {
+            /* Widen green to 6 bits by repeating its top bit */
+            uint16_t c = b[0] | (b[1] << 8);
+            px[i] = ((c & 0x7FE0) << 1) | ((c >> 4) & 0x20) | (c & 0x1F);
+            break;
+          }
+          default:
+            px[i] = ((b[2] & 0xF8) << 8) | ((b[1] & 0xFC) << 3) | (b[0] >> 3);
+            break;
+        }
+      }
+      imagePixels(img, row, col, px, 0, n);
+    }
+    if (!skipBytes(in, stride - (uint32_t)end * bpp))
+      return false;
+  }
+  return true;
+}
+
+/**************************************************************************/
+/*!
+      Helper function for the RLE image functions. Long runs are drawn by
+      the fill engine, whole rows at a time where they span them, shorter
+      runs and literal spans are sent as bulk pixel data.
+*/
+/**************************************************************************/
+boolean Adafruit_RA8875::rleBitmapHelper(int16_t x, int16_t y,
+                                         const uint8_t* data, uint32_t len,
+                                         bool progmem) {
+  uint8_t hdr[7];
+  if (len < sizeof(hdr))
+    return false;
+  for (uint8_t i = 0; i < sizeof(hdr); i++)
+    hdr[i] = rleByte(&data[i], progmem);
+  int16_t w = le16(&hdr[2]);
+  int16_t h = le16(&hdr[4]);
+  uint16_t colors = (uint16_t)hdr[6] + 1;
+  if ((hdr[0] != 'R') || (hdr[1] != 'P') || (w <= 0) || (h <= 0) ||
+      (len < sizeof(hdr) + (uint32_t)colors * 2))
+    return false;
+
+  tsImage_t img;
+  if (!imageBegin(img, x, y, w, h))
+    return true;
+
+  const uint8_t* pal = data + sizeof(hdr);
+  const uint8_t* p = pal + colors * 2;
+  const uint8_t* end = data + len;
+  int16_t chunk = RA8875_LINEBUF_SIZE / 2;
+  uint16_t px[RA8875_LINEBUF_SIZE / 2];
+  int16_t row = 0, col = 0;
+  boolean ok = true;
+
+  /* Rows below the visible part are not decoded */
+  while (ok && (row < img.sy + img.h)) {
+    if (p >= end) {
+      ok = false;
+      break;
+    }
+    uint8_t t = rleByte(p++, progmem);
+    if (t & 0x80) {
+      if (end - p < ((t & 0x40) ? 2 : 1)) {
+        ok = false;
+        break;
+      }
+      uint32_t n = t & 0x3F;
+      if (t & 0x40)
+        n |= (uint32_t)rleByte(p++, progmem) << 6;
+      n++;
+      uint8_t index = rleByte(p++, progmem);
+      if (index >= colors) {
+        ok = false;
+        break;
+      }
+      const uint8_t* c = pal + index * 2;
+      uint16_t color = rleByte(c, progmem) | (rleByte(c + 1, progmem) << 8);
+
+      while (n && (row < img.sy + img.h)) {
+        uint32_t rows = (col == 0) ? n / (uint32_t)w : 0;
+        if (rows > (uint32_t)(h - row))
+          rows = h - row;
+        if (rows * w >= RA8875_RLE_FILL_MIN) {
+          imageFill(img, row, 0, w, rows, color);
+          row += rows;
+          n -= rows * w;
+          continue;
+        }
+        int16_t span = w - col;
+        if ((uint32_t)span > n)
+          span = n;
+        if (span >= RA8875_RLE_FILL_MIN)
+          imageFill(img, row, col, span, 1, color);
+        else
+          imagePixels(img, row, col, NULL, color, span);
+        n -= span;
+        col += span;
+        if (col == w) {
+          col = 0;
+          row++;
+        }
+      }
+    } else {
+      int16_t n = (t & 0x7F) + 1;
+      if (end - p < n) {
+        ok = false;
+        break;
+      }
+      while (n) {
+        int16_t span = w - col;
+        if (span > n)
+          span = n;
+        if (span > chunk)
+          span = chunk;
+        if (row >= img.sy) {
+          for (int16_t i = 0; i < span; i++) {
+            uint8_t index = rleByte(p++, progmem);
+            if (index >= colors) {
+              ok = false;
+              break;
+            }
+            const uint8_t* c = pal + index * 2;
+            px[i] = rleByte(c, progmem) | (rleByte(c + 1, progmem) << 8);
+          }
+          if (!ok)
+            break;
+          imagePixels(img, row, col, px, 0, span);
+        } else {
+          p += span;
+        }
+        n -= span;
+        col += span;
+        if (col == w) {
+          col = 0;
+          row++;
+        }
+      }
+    }
+  }
+
+  imageEnd(img);
+  return ok;
+}
@@ -0,0 +1,124 @@
+/******************************************************************
+ This is an example for the Adafruit RA8875 Driver board for TFT displays
+ ---------------> http://www.adafruit.com/products/1590
+ The RA8875 is a TFT driver for up to 800x480 dotclock'd displays
+ It is tested to work with displays in the Adafruit shop. Other displays
+ may need timing adjustments and are not guanteed to work.
+
+ Times every public drawing primitive and prints one CSV line each:
+
+   primitive,calls,us_per_call,transactions,frames,bytes
+
+ The SPI columns are the per-call traffic counted by the library after
+ enableSpiStats(true). They read 0 if the library has been built with
+ RA8875_SPI_STATS set to 0. extras/emulator has a host version of this
+ benchmark that needs no display.
+
+ Adafruit invests time and resources providing this open
+ source code, please support Adafruit and open-source hardware
+ by purchasing products from Adafruit!
+
+ BSD license, check license.txt for more information.
+ All text above must be included in any redistribution.
+ ******************************************************************/
+
+#include <SPI.h>
+#include "Adafruit_GFX.h"
+#include "Adafruit_RA8875.h"
+
+// Library only supports hardware SPI at this time
+// Connect SCLK to UNO Digital #13 (Hardware SPI clock)
+// Connect MISO to UNO Digital #12 (Hardware SPI MISO)
+// Connect MOSI to UNO Digital #11 (Hardware SPI MOSI)
+#define RA8875_INT 3
+#define RA8875_CS 10
+#define RA8875_RESET 9
+
+#define CALLS 50
+
+Adafruit_RA8875 tft = Adafruit_RA8875(RA8875_CS, RA8875_RESET);
+uint16_t pixels[64];
+
+// Run 'call' CALLS times and report the average time and SPI traffic
+#define BENCH(name, call)                                                      \
+  do {                                                                         \
+    tft.clearSpiStats();                                                       \
+    uint32_t start = micros();                                                 \
+    for (uint16_t i = 0; i < CALLS; i++) {                                     \
+      call;                                                                    \
+    }                                                                          \
+    tft.sync();                                                                \
+    report(name, micros() - start);                                            \
+  } while (0)
+
+void report(const char *name, uint32_t us)
+{
+  tsSpiStats_t stats = tft.spiStats();
+
+  Serial.print(name);
+  Serial.print(',');
+  Serial.print(CALLS);
+  Serial.print(',');
+  Serial.print((float)us / CALLS, 1);
+  Serial.print(',');
+  Serial.print((float)stats.transactions / CALLS, 1);
+  Serial.print(',');
+  Serial.print((float)stats.frames / CALLS, 1);
+  Serial.print(',');
+  Serial.println((float)stats.bytes / CALLS, 1);
+}
+
+void setup()
+{
+  Serial.begin(9600);
+  Serial.println("RA8875 start");
+
+  /* Initialize the display using 'RA8875_480x80', 'RA8875_480x128', 'RA8875_480x272' or 'RA8875_800x480' */
+  if (!tft.begin(RA8875_800x480)) {
+    Serial.println("RA8875 Not Found!");
+    while (1);
+  }
+
+  tft.displayOn(true);
+  tft.GPIOX(true);      // Enable TFT - display enable tied to GPIOX
+  tft.PWM1config(true, RA8875_PWM_CLK_DIV1024); // PWM output for backlight
+  tft.PWM1out(255);
+  tft.touchEnable(true);
+  tft.enableSpiStats(true);
+
+  for (uint8_t i = 0; i < 64; i++)
+    pixels[i] = i * 0x0841;
+}
+
+void loop()
+{
+  uint16_t tx, ty;
+
+  Serial.println("primitive,calls,us_per_call,transactions,frames,bytes");
+
+  tft.graphicsMode();
+  BENCH("drawPixel", tft.drawPixel(i, 10, RA8875_WHITE));
+  BENCH("drawPixels", tft.drawPixels(pixels, 64, 0, 20 + i));
+  BENCH("drawLine", tft.drawLine(0, 0, 799, i * 9, RA8875_RED));
+  BENCH("fillRect", tft.fillRect(i * 10, 100, 50, 50, RA8875_GREEN));
+  BENCH("fillCircle", tft.fillCircle(400, 240, i + 10, RA8875_BLUE));
+  BENCH("fillTriangle",
+        tft.fillTriangle(100, 400, 200, 300 + i, 300, 400, RA8875_CYAN));
+  BENCH("fillEllipse", tft.fillEllipse(600, 240, 100, i + 10, RA8875_YELLOW));
+  BENCH("fillRoundRect",
+        tft.fillRoundRect(500, 350, 200, 100, i % 40 + 5, RA8875_MAGENTA));
+  BENCH("fillScreen", tft.fillScreen(i & 1 ? RA8875_BLACK : RA8875_WHITE));
+
+  tft.textMode();
+  tft.textColor(RA8875_WHITE, RA8875_BLACK);
+  BENCH("textWrite", {
+    tft.textSetCursor(10, 10);
+    tft.textWrite("RA8875 benchmark");
+  });
+  tft.graphicsMode();
+
+  BENCH("touchRead", tft.touchRead(&tx, &ty));
+
+  Serial.println();
+  delay(5000);
+}
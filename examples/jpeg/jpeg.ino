@@ -0,0 +1,79 @@
+/******************************************************************
+ This is an example for the Adafruit RA8875 Driver board for TFT displays
+ ---------------> http://www.adafruit.com/products/1590
+ The RA8875 is a TFT driver for up to 800x480 dotclock'd displays
+ It is tested to work with displays in the Adafruit shop. Other displays
+ may need timing adjustments and are not guanteed to work.
+
+ Shows a baseline JPEG image from an SD card, e.g. assets/image.jpg. The
+ image is decoded one row of blocks at a time straight into display
+ memory. Progressive JPEGs are not supported, save the image as baseline
+ (standard) first.
+
+ Adafruit invests time and resources providing this open
+ source code, please support Adafruit and open-source hardware
+ by purchasing products from Adafruit!
+
+ BSD license, check license.txt for more information.
+ All text above must be included in any redistribution.
+ ******************************************************************/
+
+#include <SPI.h>
+#include <SD.h>
+#include "Adafruit_GFX.h"
+#include "Adafruit_RA8875.h"
+
+// Library only supports hardware SPI at this time
+// Connect SCLK to UNO Digital #13 (Hardware SPI clock)
+// Connect MISO to UNO Digital #12 (Hardware SPI MISO)
+// Connect MOSI to UNO Digital #11 (Hardware SPI MOSI)
+#define RA8875_INT 3
+#define RA8875_CS 10
+#define RA8875_RESET 9
+#define SD_CS 6
+
+Adafruit_RA8875 tft = Adafruit_RA8875(RA8875_CS, RA8875_RESET);
+
+void setup()
+{
+  Serial.begin(9600);
+
+  if (!SD.begin(SD_CS)) {
+    Serial.println("SD card not found!");
+    while (1);
+  }
+
+  /* Initialize the display using 'RA8875_480x80', 'RA8875_480x128', 'RA8875_480x272' or 'RA8875_800x480' */
+  if (!tft.begin(RA8875_800x480)) {
+    Serial.println("RA8875 Not Found!");
+    while (1);
+  }
+
+  tft.displayOn(true);
+  tft.GPIOX(true);      // Enable TFT - display enable tied to GPIOX
+  tft.PWM1config(true, RA8875_PWM_CLK_DIV1024); // PWM output for backlight
+  tft.PWM1out(255);
+
+  tft.graphicsMode();
+  tft.fillScreen(RA8875_BLACK);
+
+  File file = SD.open("image.jpg");
+  if (!file) {
+    Serial.println("image.jpg not found");
+    return;
+  }
+
+  uint32_t start = millis();
+  if (tft.drawJPEG(file, 0, 0)) {
+    Serial.print("Loaded in ");
+    Serial.print(millis() - start);
+    Serial.println(" ms");
+  } else {
+    Serial.println("Not a baseline JPEG, progressive images are not supported");
+  }
+  file.close();
+}
+
+void loop()
+{
+}
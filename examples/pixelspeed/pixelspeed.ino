@@ -0,0 +1,94 @@
+/******************************************************************
+ This is an example for the Adafruit RA8875 Driver board for TFT displays
+ ---------------> http://www.adafruit.com/products/1590
+ The RA8875 is a TFT driver for up to 800x480 dotclock'd displays
+ It is tested to work with displays in the Adafruit shop. Other displays
+ may need timing adjustments and are not guanteed to work.
+
+ Measures how many pixels per second can be pushed over SPI with
+ pushPixels() (one color) and drawPixels() (an array of colors).
+
+ Adafruit invests time and resources providing this open
+ source code, please support Adafruit and open-source hardware
+ by purchasing products from Adafruit!
+
+ BSD license, check license.txt for more information.
+ All text above must be included in any redistribution.
+ ******************************************************************/
+
+#include <SPI.h>
+#include "Adafruit_GFX.h"
+#include "Adafruit_RA8875.h"
+
+// Library only supports hardware SPI at this time
+// Connect SCLK to UNO Digital #13 (Hardware SPI clock)
+// Connect MISO to UNO Digital #12 (Hardware SPI MISO)
+// Connect MOSI to UNO Digital #11 (Hardware SPI MOSI)
+#define RA8875_INT 3
+#define RA8875_CS 10
+#define RA8875_RESET 9
+
+#define LINE_PIXELS 100
+
+Adafruit_RA8875 tft = Adafruit_RA8875(RA8875_CS, RA8875_RESET);
+uint16_t line[LINE_PIXELS];
+
+void report(const char *name, uint32_t pixels, uint32_t us)
+{
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(pixels);
+  Serial.print(" pixels in ");
+  Serial.print(us);
+  Serial.print(" us = ");
+  Serial.print((uint32_t)((uint64_t)pixels * 1000000UL / us));
+  Serial.println(" pixels/sec");
+}
+
+void setup()
+{
+  Serial.begin(9600);
+  Serial.println("RA8875 start");
+
+  /* Initialize the display using 'RA8875_480x80', 'RA8875_480x128', 'RA8875_480x272' or 'RA8875_800x480' */
+  if (!tft.begin(RA8875_800x480)) {
+    Serial.println("RA8875 Not Found!");
+    while (1);
+  }
+
+  tft.displayOn(true);
+  tft.GPIOX(true);      // Enable TFT - display enable tied to GPIOX
+  tft.PWM1config(true, RA8875_PWM_CLK_DIV1024); // PWM output for backlight
+  tft.PWM1out(255);
+  tft.fillScreen(RA8875_BLACK);
+  tft.graphicsMode();
+
+  for (uint16_t i = 0; i < LINE_PIXELS; i++)
+    line[i] = i * 0x0841;
+}
+
+void loop()
+{
+  uint32_t pixels = (uint32_t)tft.width() * tft.height();
+  uint32_t start;
+
+  /* One color for the whole screen */
+  start = micros();
+  tft.setXY(0, 0);
+  tft.writeCommand(RA8875_MRWC);
+  tft.pushPixels(pixels, RA8875_BLUE);
+  report("pushPixels", pixels, micros() - start);
+
+  /* An array of colors, one line segment at a time */
+  pixels = 0;
+  start = micros();
+  for (int16_t y = 0; y < tft.height(); y++) {
+    for (int16_t x = 0; x + LINE_PIXELS <= tft.width(); x += LINE_PIXELS) {
+      tft.drawPixels(line, LINE_PIXELS, x, y);
+      pixels += LINE_PIXELS;
+    }
+  }
+  report("drawPixels", pixels, micros() - start);
+
+  delay(2000);
+}
@@ -0,0 +1,88 @@
+/******************************************************************
+ This is an example for the Adafruit RA8875 Driver board for TFT displays
+ ---------------> http://www.adafruit.com/products/1590
+ The RA8875 is a TFT driver for up to 800x480 dotclock'd displays
+ It is tested to work with displays in the Adafruit shop. Other displays
+ may need timing adjustments and are not guanteed to work.
+
+ Saves a screenshot of the display to a BMP file on an SD card. The
+ image is written a few rows per loop() call, so the sketch keeps
+ running while the file is saved.
+
+ Adafruit invests time and resources providing this open
+ source code, please support Adafruit and open-source hardware
+ by purchasing products from Adafruit!
+
+ BSD license, check license.txt for more information.
+ All text above must be included in any redistribution.
+ ******************************************************************/
+
+#include <SPI.h>
+#include <SD.h>
+#include "Adafruit_GFX.h"
+#include "Adafruit_RA8875.h"
+
+// Library only supports hardware SPI at this time
+// Connect SCLK to UNO Digital #13 (Hardware SPI clock)
+// Connect MISO to UNO Digital #12 (Hardware SPI MISO)
+// Connect MOSI to UNO Digital #11 (Hardware SPI MOSI)
+#define RA8875_INT 3
+#define RA8875_CS 10
+#define RA8875_RESET 9
+#define SD_CS 6
+
+#define ROWS_PER_LOOP 8
+
+Adafruit_RA8875 tft = Adafruit_RA8875(RA8875_CS, RA8875_RESET);
+File file;
+int16_t row = -1;
+
+void setup()
+{
+  Serial.begin(9600);
+
+  if (!SD.begin(SD_CS)) {
+    Serial.println("SD card not found!");
+    while (1);
+  }
+
+  /* Initialize the display using 'RA8875_480x80', 'RA8875_480x128', 'RA8875_480x272' or 'RA8875_800x480' */
+  if (!tft.begin(RA8875_800x480)) {
+    Serial.println("RA8875 Not Found!");
+    while (1);
+  }
+
+  tft.displayOn(true);
+  tft.GPIOX(true);      // Enable TFT - display enable tied to GPIOX
+  tft.PWM1config(true, RA8875_PWM_CLK_DIV1024); // PWM output for backlight
+  tft.PWM1out(255);
+
+  tft.graphicsMode();
+  tft.fillScreen(RA8875_BLACK);
+  tft.fillRect(20, 20, 200, 100, RA8875_RED);
+  tft.fillCircle(400, 240, 80, RA8875_GREEN);
+  tft.drawLine(0, 479, 799, 0, RA8875_YELLOW);
+
+  SD.remove("screen.bmp");
+  file = SD.open("screen.bmp", FILE_WRITE);
+  if (!file) {
+    Serial.println("Could not create screen.bmp");
+    return;
+  }
+  row = 0;
+  Serial.println("Saving screen.bmp");
+}
+
+void loop()
+{
+  if (row < 0)
+    return;
+
+  /* The rest of the UI can run between the chunks */
+  row = tft.screenshot(file, row, ROWS_PER_LOOP);
+  if (row >= tft.height()) {
+    file.close();
+    row = -1;
+    Serial.println("Done");
+  }
+}
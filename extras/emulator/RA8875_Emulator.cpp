@@ -0,0 +1,1109 @@
+/*!
+ * @file RA8875_Emulator.cpp
+ *
+ * Software model of the RA8875 for host builds, see RA8875_Emulator.h
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "RA8875_Emulator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CYCLE_DATAWRITE 0x00 ///< Data write cycle
+#define CYCLE_DATAREAD 0x40  ///< Data read cycle
+#define CYCLE_CMDWRITE 0x80  ///< Command write cycle
+#define CYCLE_CMDREAD 0xC0   ///< Status read cycle
+
+#define REG_SYSR 0x10  ///< System configuration
+#define REG_HDWR 0x14  ///< Horizontal display width
+#define REG_VDHR0 0x19 ///< Vertical display height
+#define REG_DPCR 0x20  ///< Display configuration
+#define REG_FNCR1 0x22 ///< Font control 1
+#define REG_FCURX 0x2A ///< Text cursor X
+#define REG_FCURY 0x2C ///< Text cursor Y
+#define REG_HSAW 0x30  ///< Active window left
+#define REG_VSAW 0x32  ///< Active window top
+#define REG_HEAW 0x34  ///< Active window right
+#define REG_VEAW 0x36  ///< Active window bottom
+#define REG_MRWC 0x02  ///< Memory read/write command
+#define REG_MWCR0 0x40 ///< Memory write control 0
+#define REG_MWCR1 0x41 ///< Memory write control 1
+#define REG_MRCD 0x45  ///< Memory read cursor direction
+#define REG_CURH 0x46  ///< Write cursor X
+#define REG_CURV 0x48  ///< Write cursor Y
+#define REG_RCURH 0x4A ///< Read cursor X
+#define REG_RCURV 0x4C ///< Read cursor Y
+#define REG_BECR0 0x50 ///< BTE control 0
+#define REG_BECR1 0x51 ///< BTE control 1
+#define REG_HSBE 0x54  ///< BTE source X
+#define REG_VSBE 0x56  ///< BTE source Y and layer
+#define REG_HDBE 0x58  ///< BTE destination X
+#define REG_VDBE 0x5A  ///< BTE destination Y and layer
+#define REG_BEWR 0x5C  ///< BTE width
+#define REG_BEHR 0x5E  ///< BTE height
+#define REG_BGCR 0x60  ///< Background color
+#define REG_FGCR 0x63  ///< Foreground color
+#define REG_MCLR 0x8E  ///< Memory clear control
+#define REG_DCR 0x90   ///< Draw control
+#define REG_DLHSR 0x91 ///< Line/rectangle/triangle point 0
+#define REG_DLVSR 0x93 ///< Line/rectangle/triangle point 0
+#define REG_DLHER 0x95 ///< Line/rectangle/triangle point 1
+#define REG_DLVER 0x97 ///< Line/rectangle/triangle point 1
+#define REG_DCHR 0x99  ///< Circle center X
+#define REG_DCVR 0x9B  ///< Circle center Y
+#define REG_DCRR 0x9D  ///< Circle radius
+#define REG_ELLCR 0xA0 ///< Ellipse/curve/rounded rectangle control
+#define REG_ELLA 0xA1  ///< Ellipse long axis
+#define REG_ELLB 0xA3  ///< Ellipse short axis
+#define REG_DEHR 0xA5  ///< Ellipse center X
+#define REG_DEVR 0xA7  ///< Ellipse center Y
+#define REG_DTPH 0xA9  ///< Triangle point 2 X
+#define REG_DTPV 0xAB  ///< Triangle point 2 Y
+
+RA8875_Emulator RA8875Emu;
+
+/**************************************************************************/
+/*!
+    @brief  Creates the controller in its power-on state
+*/
+/**************************************************************************/
+RA8875_Emulator::RA8875_Emulator(void) {
+  _csPin = 10;
+  reset();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns registers, display memory, pins and counters to their
+            power-on state
+*/
+/**************************************************************************/
+void RA8875_Emulator::reset(void) {
+  memset(_regs, 0, sizeof(_regs));
+  memset(_mem, 0, sizeof(_mem));
+  memset(_pins, 0, sizeof(_pins));
+  _regs[0] = 0x75;
+  _cs = true;
+  _phase = -1;
+  _cycle = 0;
+  _cmd = 0;
+  _out = 0;
+  _status = 0;
+  _memHigh = 0;
+  _memOdd = false;
+  _readDummy = false;
+  _txnDepth = 0;
+  _bteActive = false;
+  clearStats();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Selects the pin the library uses as chip select
+
+    @param pin The CS pin passed to the Adafruit_RA8875 constructor
+*/
+/**************************************************************************/
+void RA8875_Emulator::setCsPin(uint8_t pin) {
+  _csPin = pin;
+}
+
+/**************************************************************************/
+/*!
+    @brief  digitalWrite() hook. A falling edge on CS starts a new frame,
+            whose first byte selects the cycle type.
+
+    @param pin The pin being written
+    @param val HIGH or LOW
+*/
+/**************************************************************************/
+void RA8875_Emulator::pinWrite(uint8_t pin, uint8_t val) {
+  if (pin == _csPin) {
+    if (!val && _cs) {
+      _phase = 0;
+      _stats.frames++;
+    }
+    _cs = val;
+  } else if (pin < sizeof(_pins)) {
+    _pins[pin] = val;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  digitalRead() hook
+
+    @param pin The pin being read
+
+    @return The level set with setPin() or the last digitalWrite()
+*/
+/**************************************************************************/
+int RA8875_Emulator::pinRead(uint8_t pin) {
+  _stats.pinReads++;
+  return (pin < sizeof(_pins)) ? _pins[pin] : 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  SPI.beginTransaction() hook. Transactions must not nest.
+*/
+/**************************************************************************/
+void RA8875_Emulator::beginTransaction(void) {
+  if (_txnDepth++) {
+    fprintf(stderr, "RA8875 emulator: nested SPI transaction\n");
+    abort();
+  }
+  _stats.transactions++;
+}
+
+/**************************************************************************/
+/*!
+    @brief  SPI.endTransaction() hook
+*/
+/**************************************************************************/
+void RA8875_Emulator::endTransaction(void) {
+  if (_txnDepth)
+    _txnDepth--;
+}
+
+/**************************************************************************/
+/*!
+    @brief  SPI.transfer() hook, clocks one byte through the controller
+
+    @param b The byte sent by the host
+
+    @return The byte the controller drives back
+*/
+/**************************************************************************/
+uint8_t RA8875_Emulator::transfer(uint8_t b) {
+  if (_cs) {
+    fprintf(stderr, "RA8875 emulator: transfer with CS high\n");
+    abort();
+  }
+  _stats.bytes++;
+  if (_phase == 0) {
+    _cycle = b;
+    _phase = 1;
+    if (_cmd == REG_MRWC) {
+      _memOdd = false;
+      _readDummy = (_cycle == CYCLE_DATAREAD);
+    }
+    return 0;
+  }
+
+  _out = 0;
+  switch (_cycle) {
+    case CYCLE_CMDWRITE:
+      _cmd = b;
+      break;
+    case CYCLE_DATAWRITE:
+      if (_cmd != REG_MRWC)
+        writeRegister(_cmd, b);
+      else if (_bteActive)
+        bteData(b);
+      else if (_regs[REG_MWCR0] & 0x80)
+        textWrite(b);
+      else
+        memWrite(b);
+      break;
+    case CYCLE_DATAREAD:
+      _out = (_cmd == REG_MRWC) ? memRead() : _regs[_cmd];
+      break;
+    case CYCLE_CMDREAD:
+      _out = _status;
+      break;
+  }
+  return _out;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Drives an input pin, e.g. WAIT or INT
+
+    @param pin The pin number
+    @param val The level digitalRead() returns
+*/
+/**************************************************************************/
+void RA8875_Emulator::setPin(uint8_t pin, uint8_t val) {
+  if (pin < sizeof(_pins))
+    _pins[pin] = val;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets the value returned by status register reads
+
+    @param status The STSR bits to report
+*/
+/**************************************************************************/
+void RA8875_Emulator::setStatus(uint8_t status) {
+  _status = status;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Peeks at a register without a bus cycle
+
+    @param r The register address
+
+    @return The register contents
+*/
+/**************************************************************************/
+uint8_t RA8875_Emulator::reg(uint8_t r) const {
+  return _regs[r];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Peeks at display memory in controller coordinates
+
+    @param x     The column
+    @param y     The row
+    @param layer The memory layer, 0 or 1
+
+    @return The raw RGB565 or RGB332 value, 0 outside of memory
+*/
+/**************************************************************************/
+uint16_t RA8875_Emulator::pixel(int16_t x, int16_t y, uint8_t layer) const {
+  if (x < 0 || y < 0 || x >= RA8875_EMU_WIDTH || y >= RA8875_EMU_HEIGHT ||
+      layer >= RA8875_EMU_LAYERS)
+    return 0;
+  return _mem[layer][y][x];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Peeks at the pixel the panel shows at a screen position, which
+            the DPCR scan direction bits may mirror
+
+    @param x     The panel column
+    @param y     The panel row
+    @param layer The memory layer, 0 or 1
+
+    @return The raw RGB565 or RGB332 value, 0 outside of the panel
+*/
+/**************************************************************************/
+uint16_t RA8875_Emulator::screenPixel(int16_t x, int16_t y,
+                                      uint8_t layer) const {
+  if (_regs[REG_DPCR] & 0x08)
+    x = width() - 1 - x;
+  if (_regs[REG_DPCR] & 0x04)
+    y = height() - 1 - y;
+  return pixel(x, y, layer);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Converts a pixel to 8-bit RGB using the current color depth
+
+    @param x     The column
+    @param y     The row
+    @param layer The memory layer
+    @param out   Receives the red, green and blue bytes
+*/
+/**************************************************************************/
+void RA8875_Emulator::rgb(int16_t x, int16_t y, uint8_t layer,
+                          uint8_t* out) const {
+  uint16_t c = pixel(x, y, layer);
+  if (depth() == 8) {
+    out[0] = ((c >> 5) & 0x07) * 255 / 7;
+    out[1] = ((c >> 2) & 0x07) * 255 / 7;
+    out[2] = (c & 0x03) * 255 / 3;
+  } else {
+    out[0] = ((c >> 11) & 0x1F) * 255 / 31;
+    out[1] = ((c >> 5) & 0x3F) * 255 / 63;
+    out[2] = (c & 0x1F) * 255 / 31;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Panel width programmed in HDWR
+
+    @return The width in pixels
+*/
+/**************************************************************************/
+int16_t RA8875_Emulator::width(void) const {
+  int16_t w = (_regs[REG_HDWR] + 1) * 8;
+  return (w > RA8875_EMU_WIDTH) ? RA8875_EMU_WIDTH : w;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Panel height programmed in VDHR
+
+    @return The height in pixels
+*/
+/**************************************************************************/
+int16_t RA8875_Emulator::height(void) const {
+  int16_t h = (reg16(REG_VDHR0) & 0x1FF) + 1;
+  return (h > RA8875_EMU_HEIGHT) ? RA8875_EMU_HEIGHT : h;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Color depth selected in SYSR
+
+    @return 8 or 16
+*/
+/**************************************************************************/
+uint8_t RA8875_Emulator::depth(void) const {
+  return (_regs[REG_SYSR] & 0x0C) ? 16 : 8;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the bus and engine counters
+
+    @return The counters since the last clearStats() or reset()
+*/
+/**************************************************************************/
+tsEmuStats_t RA8875_Emulator::stats(void) const {
+  return _stats;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Resets the bus and engine counters
+*/
+/**************************************************************************/
+void RA8875_Emulator::clearStats(void) {
+  memset(&_stats, 0, sizeof(_stats));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Dumps a whole layer as a binary PPM image
+
+    @param path  The file to write
+    @param layer The memory layer
+
+    @return True on success
+*/
+/**************************************************************************/
+bool RA8875_Emulator::writePPM(const char* path, uint8_t layer) const {
+  return writePPM(path, layer, 0, 0, width(), height());
+}
+
+/**************************************************************************/
+/*!
+    @brief  Dumps part of a layer as a binary PPM image
+
+    @param path  The file to write
+    @param layer The memory layer
+    @param x     Left edge of the area
+    @param y     Top edge of the area
+    @param w     Width of the area
+    @param h     Height of the area
+
+    @return True on success
+*/
+/**************************************************************************/
+bool RA8875_Emulator::writePPM(const char* path, uint8_t layer, int16_t x,
+                               int16_t y, int16_t w, int16_t h) const {
+  FILE* f = fopen(path, "wb");
+  if (!f)
+    return false;
+  fprintf(f, "P6\n%d %d\n255\n", w, h);
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) {
+      uint8_t px[3];
+      rgb(x + i, y + j, layer, px);
+      fwrite(px, 1, 3, f);
+    }
+  }
+  return fclose(f) == 0;
+}
+
+/************************* Registers and memory ***************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads a little endian register pair
+*/
+/**************************************************************************/
+uint16_t RA8875_Emulator::reg16(uint8_t r) const {
+  return _regs[r] | (_regs[r + 1] << 8);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes a little endian register pair
+*/
+/**************************************************************************/
+void RA8875_Emulator::setReg16(uint8_t r, uint16_t v) {
+  _regs[r] = v & 0xFF;
+  _regs[r + 1] = v >> 8;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Layer selected for memory writes in MWCR1
+*/
+/**************************************************************************/
+uint8_t RA8875_Emulator::writeLayer(void) const {
+  return _regs[REG_MWCR1] & 0x01;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decodes a background or foreground color register triple
+*/
+/**************************************************************************/
+uint16_t RA8875_Emulator::color(uint8_t r) const {
+  if (depth() == 8)
+    return ((_regs[r] & 0x07) << 5) | ((_regs[r + 1] & 0x07) << 2) |
+           (_regs[r + 2] & 0x03);
+  return ((_regs[r] & 0x1F) << 11) | ((_regs[r + 1] & 0x3F) << 5) |
+         (_regs[r + 2] & 0x1F);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Checks a point against the active window
+*/
+/**************************************************************************/
+bool RA8875_Emulator::inWindow(int16_t x, int16_t y) const {
+  return x >= (int16_t)(reg16(REG_HSAW) & 0x3FF) &&
+         x <= (int16_t)(reg16(REG_HEAW) & 0x3FF) &&
+         y >= (int16_t)(reg16(REG_VSAW) & 0x1FF) &&
+         y <= (int16_t)(reg16(REG_VEAW) & 0x1FF);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stores one pixel of the draw engine, clipped to the active
+            window
+*/
+/**************************************************************************/
+void RA8875_Emulator::plot(int16_t x, int16_t y, uint16_t c) {
+  if (inWindow(x, y) && x < RA8875_EMU_WIDTH && y < RA8875_EMU_HEIGHT)
+    _mem[writeLayer()][y][x] = c;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Data write to a register, starting an engine where the register
+            has a start bit
+*/
+/**************************************************************************/
+void RA8875_Emulator::writeRegister(uint8_t r, uint8_t v) {
+  _regs[r] = v;
+  _stats.regWrites++;
+  switch (r) {
+    case 0x01:
+      // Soft reset bit is self clearing
+      _regs[r] &= ~0x01;
+      break;
+    case REG_BECR0:
+      if (v & 0x80) {
+        _stats.bteOps++;
+        bteStart();
+      }
+      _regs[r] &= ~0x80;
+      break;
+    case REG_MCLR:
+      if (v & 0x80) {
+        _stats.engineOps++;
+        memoryClear(v);
+      }
+      _regs[r] &= ~0x80;
+      break;
+    case REG_DCR:
+      if (v & 0xC0) {
+        _stats.engineOps++;
+        drawEngine(v);
+      }
+      _regs[r] &= ~0xC0;
+      break;
+    case REG_ELLCR:
+      if (v & 0x80) {
+        _stats.engineOps++;
+        ellipseEngine(v);
+      }
+      _regs[r] &= ~0x80;
+      break;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  MRWC data write in graphics mode. 16bpp pixels arrive high byte
+            first; writes outside the active window are dropped but still
+            move the cursor.
+*/
+/**************************************************************************/
+void RA8875_Emulator::memWrite(uint8_t b) {
+  uint16_t c = b;
+  if (depth() == 16) {
+    if (!_memOdd) {
+      _memHigh = b;
+      _memOdd = true;
+      return;
+    }
+    _memOdd = false;
+    c = (_memHigh << 8) | b;
+  }
+  _stats.memWrites++;
+  int16_t x = reg16(REG_CURH) & 0x3FF;
+  int16_t y = reg16(REG_CURV) & 0x1FF;
+  plot(x, y, c);
+  advanceWrite();
+}
+
+/**************************************************************************/
+/*!
+    @brief  MRWC data read. The first read after the cycle byte is a dummy,
+            16bpp pixels are returned low byte first.
+*/
+/**************************************************************************/
+uint8_t RA8875_Emulator::memRead(void) {
+  if (_readDummy) {
+    _readDummy = false;
+    return 0;
+  }
+  int16_t x = reg16(REG_RCURH) & 0x3FF;
+  int16_t y = reg16(REG_RCURV) & 0x1FF;
+  uint16_t c = pixel(x, y, writeLayer());
+  if (depth() == 8) {
+    _stats.memReads++;
+    advanceRead();
+    return c;
+  }
+  if (!_memOdd) {
+    _memOdd = true;
+    return c & 0xFF;
+  }
+  _memOdd = false;
+  _stats.memReads++;
+  advanceRead();
+  return c >> 8;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Moves the write cursor in the MWCR0 direction, wrapping at the
+            edges of the active window
+*/
+/**************************************************************************/
+void RA8875_Emulator::advanceWrite(void) {
+  int16_t x = reg16(REG_CURH) & 0x3FF, y = reg16(REG_CURV) & 0x1FF;
+  int16_t x0 = reg16(REG_HSAW), x1 = reg16(REG_HEAW);
+  int16_t y0 = reg16(REG_VSAW), y1 = reg16(REG_VEAW);
+  switch ((_regs[REG_MWCR0] >> 2) & 0x03) {
+    case 0: // Left->Right then Top->Down
+      if (++x > x1) {
+        x = x0;
+        if (++y > y1)
+          y = y0;
+      }
+      break;
+    case 1: // Right->Left then Top->Down
+      if (--x < x0) {
+        x = x1;
+        if (++y > y1)
+          y = y0;
+      }
+      break;
+    case 2: // Top->Down then Left->Right
+      if (++y > y1) {
+        y = y0;
+        if (++x > x1)
+          x = x0;
+      }
+      break;
+    case 3: // Down->Top then Left->Right
+      if (--y < y0) {
+        y = y1;
+        if (++x > x1)
+          x = x0;
+      }
+      break;
+  }
+  setReg16(REG_CURH, x);
+  setReg16(REG_CURV, y);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Moves the read cursor in the MRCD direction, wrapping at the
+            edges of the active window
+*/
+/**************************************************************************/
+void RA8875_Emulator::advanceRead(void) {
+  int16_t x = reg16(REG_RCURH) & 0x3FF, y = reg16(REG_RCURV) & 0x1FF;
+  int16_t x0 = reg16(REG_HSAW), x1 = reg16(REG_HEAW);
+  int16_t y0 = reg16(REG_VSAW), y1 = reg16(REG_VEAW);
+  switch (_regs[REG_MRCD] & 0x03) {
+    case 0:
+      if (++x > x1) {
+        x = x0;
+        y++;
+      }
+      break;
+    case 1:
+      if (--x < x0) {
+        x = x1;
+        y++;
+      }
+      break;
+    case 2:
+      if (++y > y1) {
+        y = y0;
+        x++;
+      }
+      break;
+    case 3:
+      if (--y < y0) {
+        y = y1;
+        x++;
+      }
+      break;
+  }
+  setReg16(REG_RCURH, x);
+  setReg16(REG_RCURV, y);
+}
+
+/**************************************************************************/
+/*!
+    @brief  MRWC data write in text mode. The font ROM is not modelled, so
+            each printable character is drawn as a foreground block with
+            its top-right quarter cut away, which keeps position, scale,
+            orientation and colors testable. With FNCR1 rotation the cell
+            is written transposed and the cursor moves down the memory.
+*/
+/**************************************************************************/
+void RA8875_Emulator::textWrite(uint8_t c) {
+  uint8_t fncr1 = _regs[REG_FNCR1];
+  bool rot = fncr1 & 0x10;
+  int16_t sx = ((fncr1 >> 2) & 0x03) + 1, sy = (fncr1 & 0x03) + 1;
+  int16_t cw = 8 * sx, ch = 16 * sy;
+  int16_t x = reg16(REG_FCURX) & 0x3FF, y = reg16(REG_FCURY) & 0x1FF;
+  uint16_t fg = color(REG_FGCR), bg = color(REG_BGCR);
+
+  _stats.memWrites++;
+  for (int16_t j = 0; j < ch; j++) {
+    for (int16_t i = 0; i < cw; i++) {
+      bool ink = (c > ' ') && i >= sx && i < cw - sx && j >= 2 * sy &&
+                 j < ch - 2 * sy && (i < cw / 2 || j >= ch / 2);
+      int16_t px = rot ? x + j : x + i, py = rot ? y + i : y + j;
+      if (ink)
+        plot(px, py, fg);
+      else if (!(fncr1 & 0x40))
+        plot(px, py, bg);
+    }
+  }
+  if (rot) {
+    y += cw;
+    if (y + cw - 1 > (int16_t)reg16(REG_VEAW)) {
+      y = reg16(REG_VSAW);
+      x += ch;
+    }
+  } else {
+    x += cw;
+    if (x + cw - 1 > (int16_t)reg16(REG_HEAW)) {
+      x = reg16(REG_HSAW);
+      y += ch;
+    }
+  }
+  setReg16(REG_FCURX, x);
+  setReg16(REG_FCURY, y);
+}
+
+/****************************** Draw engine *******************************/
+
+/**************************************************************************/
+/*!
+    @brief  Starts a line, rectangle, triangle or circle from DCR
+*/
+/**************************************************************************/
+void RA8875_Emulator::drawEngine(uint8_t dcr) {
+  uint16_t c = color(REG_FGCR);
+  bool fill = dcr & 0x20;
+  int16_t x0 = reg16(REG_DLHSR), y0 = reg16(REG_DLVSR);
+  int16_t x1 = reg16(REG_DLHER), y1 = reg16(REG_DLVER);
+
+  if (dcr & 0x40) {
+    _cx = reg16(REG_DCHR);
+    _cy = reg16(REG_DCVR);
+    _rx = _ry = _regs[REG_DCRR];
+    _part = 4;
+    shape(_cx - _rx, _cy - _ry, _cx + _rx, _cy + _ry, fill, c,
+          &RA8875_Emulator::insideEllipse);
+  } else if (dcr & 0x10) {
+    if (x0 > x1) {
+      int16_t t = x0;
+      x0 = x1;
+      x1 = t;
+    }
+    if (y0 > y1) {
+      int16_t t = y0;
+      y0 = y1;
+      y1 = t;
+    }
+    for (int16_t y = y0; y <= y1; y++)
+      for (int16_t x = x0; x <= x1; x++)
+        if (fill || x == x0 || x == x1 || y == y0 || y == y1)
+          plot(x, y, c);
+  } else if (dcr & 0x01) {
+    triangle(x0, y0, x1, y1, reg16(REG_DTPH), reg16(REG_DTPV), fill, c);
+  } else {
+    line(x0, y0, x1, y1, c);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Starts an ellipse, curve or rounded rectangle from register 0xA0
+*/
+/**************************************************************************/
+void RA8875_Emulator::ellipseEngine(uint8_t ctrl) {
+  uint16_t c = color(REG_FGCR);
+  bool fill = ctrl & 0x40;
+  _rx = reg16(REG_ELLA);
+  _ry = reg16(REG_ELLB);
+
+  if (ctrl & 0x20) {
+    _sx0 = reg16(REG_DLHSR);
+    _sy0 = reg16(REG_DLVSR);
+    _sx1 = reg16(REG_DLHER);
+    _sy1 = reg16(REG_DLVER);
+    _part = 4;
+    shape(_sx0, _sy0, _sx1, _sy1, fill, c, &RA8875_Emulator::insideRoundRect);
+  } else {
+    _cx = reg16(REG_DEHR);
+    _cy = reg16(REG_DEVR);
+    _part = (ctrl & 0x10) ? (ctrl & 0x03) : 4;
+    shape(_cx - _rx, _cy - _ry, _cx + _rx, _cy + _ry, fill, c,
+          &RA8875_Emulator::insideEllipse);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clears the full or the active window with the background color
+*/
+/**************************************************************************/
+void RA8875_Emulator::memoryClear(uint8_t mclr) {
+  uint16_t c = color(REG_BGCR);
+  for (int16_t y = 0; y < height(); y++)
+    for (int16_t x = 0; x < width(); x++)
+      if (!(mclr & 0x40) || inWindow(x, y))
+        _mem[writeLayer()][y][x] = c;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Bresenham line including both end points
+*/
+/**************************************************************************/
+void RA8875_Emulator::line(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                           uint16_t c) {
+  int16_t dx = abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+  int16_t dy = -abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+  int32_t err = dx + dy;
+  while (1) {
+    plot(x0, y0, c);
+    if (x0 == x1 && y0 == y1)
+      break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Which side of the edge (x0,y0)-(x1,y1) a point lies on
+*/
+/**************************************************************************/
+static int32_t edge(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x,
+                    int16_t y) {
+  return (int32_t)(x1 - x0) * (y - y0) - (int32_t)(y1 - y0) * (x - x0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Triangle outline or fill. Filled pixels are those whose centers
+            lie inside or on the edges.
+*/
+/**************************************************************************/
+void RA8875_Emulator::triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                               int16_t x2, int16_t y2, bool fill, uint16_t c) {
+  if (fill) {
+    int16_t minX = x0, maxX = x0, minY = y0, maxY = y0;
+    int16_t xs[2] = {x1, x2}, ys[2] = {y1, y2};
+    for (uint8_t i = 0; i < 2; i++) {
+      if (xs[i] < minX)
+        minX = xs[i];
+      if (xs[i] > maxX)
+        maxX = xs[i];
+      if (ys[i] < minY)
+        minY = ys[i];
+      if (ys[i] > maxY)
+        maxY = ys[i];
+    }
+    for (int16_t y = minY; y <= maxY; y++) {
+      for (int16_t x = minX; x <= maxX; x++) {
+        int32_t e0 = edge(x0, y0, x1, y1, x, y);
+        int32_t e1 = edge(x1, y1, x2, y2, x, y);
+        int32_t e2 = edge(x2, y2, x0, y0, x, y);
+        if ((e0 >= 0 && e1 >= 0 && e2 >= 0) || (e0 <= 0 && e1 <= 0 && e2 <= 0))
+          plot(x, y, c);
+      }
+    }
+  }
+  line(x0, y0, x1, y1, c);
+  line(x1, y1, x2, y2, c);
+  line(x2, y2, x0, y0, c);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Rasterizes a shape given by an inside test over its bounding
+            box. The outline is every inside pixel with a 4-neighbour that
+            is outside. Curves keep the part of the shape in their
+            quadrant.
+*/
+/**************************************************************************/
+void RA8875_Emulator::shape(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            bool fill, uint16_t c,
+                            bool (RA8875_Emulator::*inside)(int16_t,
+                                                            int16_t)) {
+  for (int16_t y = y0; y <= y1; y++) {
+    for (int16_t x = x0; x <= x1; x++) {
+      if (!inPart(x, y) || !(this->*inside)(x, y))
+        continue;
+      if (fill || !(this->*inside)(x - 1, y) || !(this->*inside)(x + 1, y) ||
+          !(this->*inside)(x, y - 1) || !(this->*inside)(x, y + 1))
+        plot(x, y, c);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Checks a point against the ellipse quadrant being drawn. Curve
+            part 0 is the lower left quadrant, continuing clockwise; any
+            other value selects the whole shape.
+*/
+/**************************************************************************/
+bool RA8875_Emulator::inPart(int16_t x, int16_t y) const {
+  switch (_part) {
+    case 0:
+      return x <= _cx && y >= _cy;
+    case 1:
+      return x <= _cx && y <= _cy;
+    case 2:
+      return x >= _cx && y <= _cy;
+    case 3:
+      return x >= _cx && y >= _cy;
+    default:
+      return true;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Inside test for circles and ellipses
+*/
+/**************************************************************************/
+bool RA8875_Emulator::insideEllipse(int16_t x, int16_t y) {
+  int32_t dx = x - _cx, dy = y - _cy;
+  // dx^2 / rx^2 + dy^2 / ry^2 <= 1, with half a pixel added to the radii
+  int64_t rx = 2 * _rx + 1, ry = 2 * _ry + 1;
+  return 4 * dx * dx * ry * ry + 4 * dy * dy * rx * rx <= rx * rx * ry * ry;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Inside test for rounded rectangles with corner radii _rx, _ry
+*/
+/**************************************************************************/
+bool RA8875_Emulator::insideRoundRect(int16_t x, int16_t y) {
+  if (x < _sx0 || x > _sx1 || y < _sy0 || y > _sy1)
+    return false;
+  // Points outside the corner squares are inside, the others are tested
+  // against the ellipse centered on the nearest corner
+  int16_t cx = x, cy = y;
+  if (x < _sx0 + _rx)
+    cx = _sx0 + _rx;
+  else if (x > _sx1 - _rx)
+    cx = _sx1 - _rx;
+  if (y < _sy0 + _ry)
+    cy = _sy0 + _ry;
+  else if (y > _sy1 - _ry)
+    cy = _sy1 - _ry;
+  if (cx == x || cy == y)
+    return true;
+  _cx = cx;
+  _cy = cy;
+  return insideEllipse(x, y);
+}
+
+/************************* Block transfer engine **************************/
+
+/**************************************************************************/
+/*!
+    @brief  Raster operation on two pixels
+*/
+/**************************************************************************/
+uint16_t RA8875_Emulator::rop(uint8_t code, uint16_t s, uint16_t d) {
+  switch (code & 0x0F) {
+    case 0x0:
+      return 0;
+    case 0x1:
+      return ~(s | d);
+    case 0x2:
+      return ~s & d;
+    case 0x3:
+      return ~s;
+    case 0x4:
+      return s & ~d;
+    case 0x5:
+      return ~d;
+    case 0x6:
+      return s ^ d;
+    case 0x7:
+      return ~(s & d);
+    case 0x8:
+      return s & d;
+    case 0x9:
+      return ~(s ^ d);
+    case 0xA:
+      return d;
+    case 0xB:
+      return ~s | d;
+    case 0xC:
+      return s;
+    case 0xD:
+      return s | ~d;
+    case 0xE:
+      return s | d;
+    default:
+      return 0xFFFF;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Starts the BTE operation in BECR1. Moves and fills complete
+            immediately, walking memory in the same order as the hardware so
+            an overlapping move in the wrong direction corrupts the result
+            just like on the chip. Writes and color expansion wait for their
+            data through MRWC. BTE operations are not clipped to the active
+            window.
+*/
+/**************************************************************************/
+void RA8875_Emulator::bteStart(void) {
+  uint8_t op = _regs[REG_BECR1] & 0x0F, code = _regs[REG_BECR1] >> 4;
+  int16_t sx = reg16(REG_HSBE) & 0x3FF, sy = reg16(REG_VSBE) & 0x1FF;
+  int16_t dx = reg16(REG_HDBE) & 0x3FF, dy = reg16(REG_VDBE) & 0x1FF;
+  uint8_t sl = _regs[REG_VSBE + 1] >> 7, dl = _regs[REG_VDBE + 1] >> 7;
+  int16_t w = reg16(REG_BEWR) & 0x3FF, h = reg16(REG_BEHR) & 0x1FF;
+  uint16_t key = color(REG_FGCR);
+  int16_t step = (op == 0x03) ? -1 : 1;
+
+  switch (op) {
+    case 0x02: // Move in positive direction with ROP
+    case 0x03: // Move in negative direction with ROP
+    case 0x05: // Transparent move in positive direction
+      for (int16_t j = 0; j < h; j++) {
+        for (int16_t i = 0; i < w; i++) {
+          int16_t ox = step * i, oy = step * j;
+          uint16_t s = pixel(sx + ox, sy + oy, sl);
+          int16_t x = dx + ox, y = dy + oy;
+          if (x < 0 || y < 0 || x >= RA8875_EMU_WIDTH || y >= RA8875_EMU_HEIGHT)
+            continue;
+          uint16_t& d = _mem[dl][y][x];
+          if (op != 0x05)
+            d = rop(code, s, d);
+          else if (s != key)
+            d = s;
+        }
+      }
+      break;
+    case 0x0C: // Solid fill
+      for (int16_t j = 0; j < h; j++)
+        for (int16_t i = 0; i < w; i++)
+          if (dx + i < RA8875_EMU_WIDTH && dy + j < RA8875_EMU_HEIGHT)
+            _mem[dl][dy + j][dx + i] = key;
+      break;
+    case 0x00: // Write with ROP
+    case 0x04: // Transparent write
+    case 0x08: // Color expansion
+    case 0x09: // Color expansion with transparency
+      _bteActive = (w > 0 && h > 0);
+      _bteOp = op;
+      _bteRop = code;
+      _bteLayer = dl;
+      _bteX = dx;
+      _bteY = dy;
+      _bteW = w;
+      _bteH = h;
+      _bteIndex = 0;
+      _memOdd = false;
+      break;
+    default:
+      fprintf(stderr, "RA8875 emulator: unsupported BTE operation %d\n", op);
+      abort();
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  MRWC data for a streamed BTE operation. Color expansion takes
+            eight pixels per byte, most significant bit first, and every
+            row starts on a new byte.
+*/
+/**************************************************************************/
+void RA8875_Emulator::bteData(uint8_t b) {
+  if (_bteOp == 0x08 || _bteOp == 0x09) {
+    for (int8_t bit = 7; bit >= 0 && _bteActive; bit--) {
+      bool set = (b >> bit) & 1;
+      if (_bteOp == 0x08)
+        bteStore(set ? color(REG_FGCR) : color(REG_BGCR), false);
+      else
+        bteStore(color(REG_FGCR), !set);
+      if (_bteIndex % _bteW == 0)
+        break;
+    }
+    return;
+  }
+  uint16_t c = b;
+  if (depth() == 16) {
+    if (!_memOdd) {
+      _memHigh = b;
+      _memOdd = true;
+      return;
+    }
+    _memOdd = false;
+    c = (_memHigh << 8) | b;
+  }
+  bteStore(c, _bteOp == 0x04 && c == color(REG_FGCR));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stores the next pixel of a streamed BTE operation
+*/
+/**************************************************************************/
+void RA8875_Emulator::bteStore(uint16_t c, bool skip) {
+  int16_t x = _bteX + _bteIndex % _bteW, y = _bteY + _bteIndex / _bteW;
+  _stats.memWrites++;
+  if (!skip && x < RA8875_EMU_WIDTH && y < RA8875_EMU_HEIGHT) {
+    uint16_t& d = _mem[_bteLayer][y][x];
+    d = (_bteOp == 0x00) ? rop(_bteRop, c, d) : c;
+  }
+  if (++_bteIndex >= (uint32_t)_bteW * _bteH)
+    _bteActive = false;
+}
@@ -0,0 +1,143 @@
+/*!
+ * @file RA8875_Emulator.h
+ *
+ * Host-side software model of the RA8875, used to run and test the library
+ * on Linux without a display attached. The Arduino and SPI stubs in stubs/
+ * feed every pin change and bus cycle into the single RA8875Emu instance,
+ * which keeps a register file, two layers of display memory and the drawing
+ * engines.
+ *
+ * The model is byte exact for register and memory traffic. The draw engine
+ * rasterizes lines, rectangles, triangles, circles, ellipses, curves and
+ * rounded rectangles with its own algorithms, which are close to but not
+ * pixel identical with the silicon. Engines complete instantly, so the
+ * status register only reports busy bits set with setStatus().
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#ifndef _RA8875_EMULATOR_H
+#define _RA8875_EMULATOR_H ///< File has been included
+
+#include <stdint.h>
+
+#define RA8875_EMU_WIDTH 800  ///< Largest supported panel width
+#define RA8875_EMU_HEIGHT 480 ///< Largest supported panel height
+#define RA8875_EMU_LAYERS 2   ///< Number of display memory layers
+
+/**************************************************************************/
+/*!
+    @brief  Bus traffic seen by the emulator
+*/
+/**************************************************************************/
+typedef struct {
+  uint32_t transactions; ///< SPI beginTransaction() calls
+  uint32_t frames;       ///< CS low periods
+  uint32_t bytes;        ///< Bytes clocked on the bus
+  uint32_t regWrites;    ///< Data writes to registers other than MRWC
+  uint32_t memWrites;    ///< Pixels written through MRWC
+  uint32_t memReads;     ///< Pixels read through MRWC
+  uint32_t engineOps;    ///< Draw engine and memory clear starts
+  uint32_t bteOps;       ///< BTE starts
+  uint32_t pinReads;     ///< digitalRead() calls
+} tsEmuStats_t;
+
+/**************************************************************************/
+/*!
+    @brief  Software model of the RA8875 controller
+*/
+/**************************************************************************/
+class RA8875_Emulator {
+ public:
+  RA8875_Emulator(void);
+
+  void reset(void);
+  void setCsPin(uint8_t pin);
+
+  /* Bus side, called by the Arduino and SPI stubs */
+  void pinWrite(uint8_t pin, uint8_t val);
+  int pinRead(uint8_t pin);
+  void beginTransaction(void);
+  void endTransaction(void);
+  uint8_t transfer(uint8_t b);
+
+  /* Test side */
+  void setPin(uint8_t pin, uint8_t val);
+  void setStatus(uint8_t status);
+  uint8_t reg(uint8_t r) const;
+  uint16_t pixel(int16_t x, int16_t y, uint8_t layer = 0) const;
+  uint16_t screenPixel(int16_t x, int16_t y, uint8_t layer = 0) const;
+  void rgb(int16_t x, int16_t y, uint8_t layer, uint8_t* out) const;
+  int16_t width(void) const;
+  int16_t height(void) const;
+  uint8_t depth(void) const;
+  tsEmuStats_t stats(void) const;
+  void clearStats(void);
+  bool writePPM(const char* path, uint8_t layer = 0) const;
+  bool writePPM(const char* path, uint8_t layer, int16_t x, int16_t y,
+                int16_t w, int16_t h) const;
+
+ private:
+  uint16_t reg16(uint8_t r) const;
+  void setReg16(uint8_t r, uint16_t v);
+  uint8_t writeLayer(void) const;
+  uint16_t color(uint8_t r) const;
+  bool inWindow(int16_t x, int16_t y) const;
+  void plot(int16_t x, int16_t y, uint16_t c);
+  void writeRegister(uint8_t r, uint8_t v);
+  void memWrite(uint8_t b);
+  uint8_t memRead(void);
+  void advanceWrite(void);
+  void advanceRead(void);
+  void textWrite(uint8_t c);
+
+  /* Draw engine */
+  void drawEngine(uint8_t dcr);
+  void ellipseEngine(uint8_t ctrl);
+  void memoryClear(uint8_t mclr);
+  void line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c);
+  void triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2,
+                int16_t y2, bool fill, uint16_t c);
+  void shape(int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool fill,
+             uint16_t c, bool (RA8875_Emulator::*inside)(int16_t, int16_t));
+  bool inPart(int16_t x, int16_t y) const;
+  bool insideEllipse(int16_t x, int16_t y);
+  bool insideRoundRect(int16_t x, int16_t y);
+
+  /* Block transfer engine */
+  void bteStart(void);
+  void bteData(uint8_t b);
+  void bteStore(uint16_t c, bool skip);
+  static uint16_t rop(uint8_t code, uint16_t s, uint16_t d);
+
+  uint8_t _regs[256];
+  uint16_t _mem[RA8875_EMU_LAYERS][RA8875_EMU_HEIGHT][RA8875_EMU_WIDTH];
+  uint8_t _pins[64];
+  uint8_t _csPin;
+  bool _cs;
+  int8_t _phase;
+  uint8_t _cycle;
+  uint8_t _cmd;
+  uint8_t _out;
+  uint8_t _status;
+  uint8_t _memHigh;
+  bool _memOdd;
+  bool _readDummy;
+  uint8_t _txnDepth;
+  tsEmuStats_t _stats;
+
+  /* Shape being rasterized */
+  int16_t _cx, _cy, _rx, _ry;
+  int16_t _sx0, _sy0, _sx1, _sy1;
+  uint8_t _part;
+
+  /* Streamed BTE operation */
+  bool _bteActive;
+  uint8_t _bteOp, _bteRop, _bteLayer;
+  int16_t _bteX, _bteY, _bteW, _bteH;
+  uint32_t _bteIndex;
+};
+
+extern RA8875_Emulator RA8875Emu; ///< The controller the stubs talk to
+
+#endif
@@ -0,0 +1,113 @@
+/*!
+ * @file benchmark.cpp
+ *
+ * Host version of examples/benchmark. Runs the same primitives against the
+ * emulator and prints the average SPI traffic per call as CSV:
+ *
+ *   primitive,calls,transactions,frames,bytes,reg_writes,pixels
+ *
+ * Time is simulated on the host, so there is no microseconds column. The
+ * library's own counters are checked against the emulator's, and the
+ * program exits with an error if they disagree.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "Adafruit_RA8875.h"
+#include "RA8875_Emulator.h"
+
+#define CALLS 50 ///< Calls per primitive
+
+static Adafruit_RA8875 tft(10, 9);
+static uint16_t pixels[64];
+
+/* A 2x2 dot and a 6x6 ring, as '.' and '/' */
+static const uint8_t glyphBits[] = {0xF0, 0x7B, 0x38, 0x61, 0xCD, 0xE0};
+static const GFXglyph glyphs[] = {{0, 2, 2, 3, 0, -2}, {1, 6, 6, 7, 0, -6}};
+static const GFXfont glyphFont = {(uint8_t*)glyphBits, (GFXglyph*)glyphs, '.',
+                                  '/', 8};
+static bool mismatch;
+
+/// Run 'call' CALLS times and report the average SPI traffic
+#define BENCH(name, call)                  \
+  do {                                     \
+    tft.clearSpiStats();                   \
+    RA8875Emu.clearStats();                \
+    for (uint16_t i = 0; i < CALLS; i++) { \
+      call;                                \
+    }                                      \
+    tft.sync();                            \
+    report(name);                          \
+  } while (0)
+
+/**************************************************************************/
+/*!
+    @brief  Prints one CSV line and cross-checks the library counters
+*/
+/**************************************************************************/
+static void report(const char* name) {
+  tsSpiStats_t lib = tft.spiStats();
+  tsEmuStats_t emu = RA8875Emu.stats();
+
+  printf("%s,%d,%.1f,%.1f,%.1f,%.1f,%.1f\n", name, CALLS,
+         (float)emu.transactions / CALLS, (float)emu.frames / CALLS,
+         (float)emu.bytes / CALLS, (float)emu.regWrites / CALLS,
+         (float)emu.memWrites / CALLS);
+  if (lib.transactions != emu.transactions || lib.frames != emu.frames ||
+      lib.bytes != emu.bytes) {
+    fprintf(stderr, "%s: library counted %u/%u/%u, emulator %u/%u/%u\n",
+            name, (unsigned)lib.transactions, (unsigned)lib.frames,
+            (unsigned)lib.bytes, (unsigned)emu.transactions,
+            (unsigned)emu.frames, (unsigned)emu.bytes);
+    mismatch = true;
+  }
+}
+
+int main(void) {
+  uint16_t tx, ty;
+
+  RA8875Emu.setCsPin(10);
+  if (!tft.begin(RA8875_800x480)) {
+    fprintf(stderr, "RA8875 Not Found!\n");
+    return 1;
+  }
+  tft.displayOn(true);
+  tft.touchEnable(true);
+  tft.enableSpiStats(true);
+  for (uint8_t i = 0; i < 64; i++)
+    pixels[i] = i * 0x0841;
+
+  printf("primitive,calls,transactions,frames,bytes,reg_writes,pixels\n");
+
+  tft.graphicsMode();
+  BENCH("drawPixel", tft.drawPixel(i, 10, RA8875_WHITE));
+  BENCH("drawPixels", tft.drawPixels(pixels, 64, 0, 20 + i));
+  BENCH("drawLine", tft.drawLine(0, 0, 799, i * 9, RA8875_RED));
+  BENCH("fillRect", tft.fillRect(i * 10, 100, 50, 50, RA8875_GREEN));
+  BENCH("fillCircle", tft.fillCircle(400, 240, i + 10, RA8875_BLUE));
+  BENCH("fillTriangle",
+        tft.fillTriangle(100, 400, 200, 300 + i, 300, 400, RA8875_CYAN));
+  BENCH("fillEllipse", tft.fillEllipse(600, 240, 100, i + 10, RA8875_YELLOW));
+  BENCH("fillRoundRect",
+        tft.fillRoundRect(500, 350, 200, 100, i % 40 + 5, RA8875_MAGENTA));
+  BENCH("fillScreen", tft.fillScreen(i & 1 ? RA8875_BLACK : RA8875_WHITE));
+
+  tft.textMode();
+  tft.textColor(RA8875_WHITE, RA8875_BLACK);
+  BENCH("textWrite", {
+    tft.textSetCursor(10, 10);
+    tft.textWrite("RA8875 benchmark");
+  });
+  tft.graphicsMode();
+
+  tft.setFont(&glyphFont);
+  BENCH("drawChar 2x2",
+        tft.drawChar(i * 8, 300, '.', RA8875_WHITE, RA8875_WHITE, 1, 1));
+  BENCH("drawChar 6x6",
+        tft.drawChar(i * 8, 310, '/', RA8875_WHITE, RA8875_WHITE, 1, 1));
+  tft.setFont();
+
+  BENCH("touchRead", tft.touchRead(&tx, &ty));
+
+  return mismatch ? 1 : 0;
+}
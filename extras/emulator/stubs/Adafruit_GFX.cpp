@@ -0,0 +1,443 @@
+/*!
+ * @file Adafruit_GFX.cpp
+ *
+ * Cut-down Adafruit_GFX for host builds, see Adafruit_GFX.h
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "Adafruit_GFX.h"
+
+/**************************************************************************/
+/*!
+    @brief  Instatiate a GFX context for graphics
+    @param  w Display width, in pixels
+    @param  h Display height, in pixels
+*/
+/**************************************************************************/
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
+  _width = WIDTH;
+  _height = HEIGHT;
+  rotation = 0;
+  cursor_y = cursor_x = 0;
+  textsize_x = textsize_y = 1;
+  textcolor = textbgcolor = 0xFFFF;
+  wrap = true;
+  _cp437 = false;
+  gfxFont = NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Start a batch of writes, nothing to do by default
+*/
+/**************************************************************************/
+void Adafruit_GFX::startWrite(void) {}
+
+/**************************************************************************/
+/*!
+    @brief  Write a pixel inside a batch
+*/
+/**************************************************************************/
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
+  drawPixel(x, y, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Write a filled rectangle inside a batch
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  fillRect(x, y, w, h, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Write a vertical line inside a batch
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h,
+                                  uint16_t color) {
+  drawFastVLine(x, y, h, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Write a horizontal line inside a batch
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w,
+                                  uint16_t color) {
+  drawFastHLine(x, y, w, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Bresenham line inside a batch
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             uint16_t color) {
+  int16_t dx = abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+  int16_t dy = -abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+  int32_t err = dx + dy;
+  while (1) {
+    writePixel(x0, y0, color);
+    if (x0 == x1 && y0 == y1)
+      break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  End a batch of writes, nothing to do by default
+*/
+/**************************************************************************/
+void Adafruit_GFX::endWrite(void) {}
+
+/**************************************************************************/
+/*!
+    @brief  Set rotation setting for display
+    @param  x 0 thru 3 corresponding to 4 cardinal rotations
+*/
+/**************************************************************************/
+void Adafruit_GFX::setRotation(uint8_t x) {
+  rotation = (x & 3);
+  _width = (rotation & 1) ? HEIGHT : WIDTH;
+  _height = (rotation & 1) ? WIDTH : HEIGHT;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Invert the display, not supported by default
+*/
+/**************************************************************************/
+void Adafruit_GFX::invertDisplay(bool i) {}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a vertical line
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                 uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a horizontal line
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                 uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fill a rectangle pixel by pixel
+*/
+/**************************************************************************/
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  startWrite();
+  for (int16_t j = y; j < y + h; j++)
+    for (int16_t i = x; i < x + w; i++)
+      writePixel(i, j, color);
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fill the whole screen
+*/
+/**************************************************************************/
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a line
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color) {
+  startWrite();
+  writeLine(x0, y0, x1, y1, color);
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a rectangle outline
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw an RGB565 bitmap
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                                 int16_t w, int16_t h) {
+  drawRGBBitmap(x, y, bitmap, NULL, w, h);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw an RGB565 bitmap from RAM
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                                 int16_t w, int16_t h) {
+  drawRGBBitmap(x, y, (const uint16_t*)bitmap, NULL, w, h);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw an RGB565 bitmap with a 1-bit mask, rows padded to bytes
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                                 const uint8_t mask[], int16_t w, int16_t h) {
+  int16_t bw = (w + 7) / 8;
+  startWrite();
+  for (int16_t j = 0; j < h; j++)
+    for (int16_t i = 0; i < w; i++)
+      if (!mask || (mask[j * bw + i / 8] & (0x80 >> (i & 7))))
+        writePixel(x + i, y + j, bitmap[j * w + i]);
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw an RGB565 bitmap with a 1-bit mask from RAM
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                                 uint8_t* mask, int16_t w, int16_t h) {
+  drawRGBBitmap(x, y, (const uint16_t*)bitmap, (const uint8_t*)mask, w, h);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw an 8-bit grayscale bitmap
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
+                                       const uint8_t bitmap[], int16_t w,
+                                       int16_t h) {
+  drawGrayscaleBitmap(x, y, bitmap, NULL, w, h);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw an 8-bit grayscale bitmap from RAM
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap,
+                                       int16_t w, int16_t h) {
+  drawGrayscaleBitmap(x, y, (const uint8_t*)bitmap, NULL, w, h);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw an 8-bit grayscale bitmap with a 1-bit mask. Like the real
+            library, the gray value is written as the raw pixel value.
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
+                                       const uint8_t bitmap[],
+                                       const uint8_t mask[], int16_t w,
+                                       int16_t h) {
+  int16_t bw = (w + 7) / 8;
+  startWrite();
+  for (int16_t j = 0; j < h; j++)
+    for (int16_t i = 0; i < w; i++)
+      if (!mask || (mask[j * bw + i / 8] & (0x80 >> (i & 7))))
+        writePixel(x + i, y + j, bitmap[j * w + i]);
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw an 8-bit grayscale bitmap with a 1-bit mask from RAM
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap,
+                                       uint8_t* mask, int16_t w, int16_t h) {
+  drawGrayscaleBitmap(x, y, (const uint8_t*)bitmap, (const uint8_t*)mask, w,
+                      h);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a single character with the same size in X and Y
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                            uint16_t color, uint16_t bg, uint8_t size) {
+  drawChar(x, y, c, color, bg, size, size);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a single character. GFX font glyphs are drawn from their
+            bitmaps; the classic font is not included, so its printable
+            characters are drawn as a 5x7 block on a 6x8 cell.
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                            uint16_t color, uint16_t bg, uint8_t size_x,
+                            uint8_t size_y) {
+  startWrite();
+  if (!gfxFont) {
+    for (int16_t j = 0; j < 8; j++) {
+      for (int16_t i = 0; i < 6; i++) {
+        bool ink = (c > ' ') && i < 5 && j < 7;
+        if (ink || bg != color)
+          writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y,
+                        ink ? color : bg);
+      }
+    }
+  } else {
+    GFXglyph* glyph = gfxFont->glyph + (c - gfxFont->first);
+    const uint8_t* bitmap = gfxFont->bitmap + glyph->bitmapOffset;
+    uint8_t bits = 0, bit = 0;
+    for (int16_t j = 0; j < glyph->height; j++) {
+      for (int16_t i = 0; i < glyph->width; i++) {
+        if (!(bit++ & 7))
+          bits = *bitmap++;
+        if (!(bits & 0x80)) {
+          // Clear bits are transparent
+        } else if (size_x == 1 && size_y == 1) {
+          writePixel(x + glyph->xOffset + i, y + glyph->yOffset + j, color);
+        } else {
+          writeFillRect(x + (glyph->xOffset + i) * size_x,
+                        y + (glyph->yOffset + j) * size_y, size_x, size_y,
+                        color);
+        }
+        bits <<= 1;
+      }
+    }
+  }
+  endWrite();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Print one byte/character of data, used to support print()
+    @param  c The 8-bit ascii character to write
+    @return 1
+*/
+/**************************************************************************/
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (!gfxFont) {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += textsize_y * 8;
+    } else if (c != '\r') {
+      if (wrap && ((cursor_x + textsize_x * 6) > _width)) {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x,
+               textsize_y);
+      cursor_x += textsize_x * 6;
+    }
+  } else {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+    } else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+      GFXglyph* glyph = gfxFont->glyph + (c - gfxFont->first);
+      if (glyph->width > 0 && glyph->height > 0) {
+        int16_t xo = glyph->xOffset;
+        if (wrap && ((cursor_x + textsize_x * (xo + glyph->width)) > _width)) {
+          cursor_x = 0;
+          cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x,
+                 textsize_y);
+      }
+      cursor_x += glyph->xAdvance * (int16_t)textsize_x;
+    }
+  }
+  return 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set text cursor location
+*/
+/**************************************************************************/
+void Adafruit_GFX::setCursor(int16_t x, int16_t y) {
+  cursor_x = x;
+  cursor_y = y;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set text color with transparent background
+*/
+/**************************************************************************/
+void Adafruit_GFX::setTextColor(uint16_t c) {
+  textcolor = textbgcolor = c;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set text foreground and background colors
+*/
+/**************************************************************************/
+void Adafruit_GFX::setTextColor(uint16_t c, uint16_t bg) {
+  textcolor = c;
+  textbgcolor = bg;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set text magnification
+*/
+/**************************************************************************/
+void Adafruit_GFX::setTextSize(uint8_t s) {
+  textsize_x = textsize_y = (s > 0) ? s : 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set whether text wraps at the right edge
+*/
+/**************************************************************************/
+void Adafruit_GFX::setTextWrap(bool w) {
+  wrap = w;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set the font, NULL for the classic font
+*/
+/**************************************************************************/
+void Adafruit_GFX::setFont(const GFXfont* f) {
+  gfxFont = (GFXfont*)f;
+}
@@ -0,0 +1,130 @@
+/*!
+ * @file Adafruit_GFX.h
+ *
+ * Cut-down Adafruit_GFX for host builds. It has the same virtual interface
+ * as the real library, with plain pixel loops as fallbacks. The classic
+ * 5x7 font is not included; its glyphs are drawn as solid blocks. GFX fonts
+ * are rendered normally.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#ifndef _ADAFRUIT_GFX_H
+#define _ADAFRUIT_GFX_H ///< File has been included
+
+#include "Arduino.h"
+#include "gfxfont.h"
+
+/**************************************************************************/
+/*!
+    @brief  Base class for the display drivers
+*/
+/**************************************************************************/
+class Adafruit_GFX : public Print {
+ public:
+  Adafruit_GFX(int16_t w, int16_t h);
+
+  /*!
+      @brief  Draws one pixel, implemented by the driver
+      @param  x     The column
+      @param  y     The row
+      @param  color The RGB565 color
+  */
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void startWrite(void);
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color);
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color);
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h,
+                              uint16_t color);
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w,
+                              uint16_t color);
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         uint16_t color);
+  virtual void endWrite(void);
+
+  virtual void setRotation(uint8_t r);
+  virtual void invertDisplay(bool i);
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                        uint16_t color);
+  virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w,
+                     int16_t h);
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w,
+                     int16_t h);
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                     const uint8_t mask[], int16_t w, int16_t h);
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, uint8_t* mask,
+                     int16_t w, int16_t h);
+  void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                           int16_t w, int16_t h);
+  void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w,
+                           int16_t h);
+  void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                           const uint8_t mask[], int16_t w, int16_t h);
+  void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap,
+                           uint8_t* mask, int16_t w, int16_t h);
+
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size);
+  virtual void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                        uint16_t bg, uint8_t size_x, uint8_t size_y);
+  virtual size_t write(uint8_t c);
+  using Print::write;
+
+  void setCursor(int16_t x, int16_t y);
+  void setTextColor(uint16_t c);
+  void setTextColor(uint16_t c, uint16_t bg);
+  void setTextSize(uint8_t s);
+  void setTextWrap(bool w);
+  void setFont(const GFXfont* f = NULL);
+
+  /*!
+      @brief  Display width with the current rotation
+      @return The width in pixels
+  */
+  int16_t width(void) const {
+    return _width;
+  }
+  /*!
+      @brief  Display height with the current rotation
+      @return The height in pixels
+  */
+  int16_t height(void) const {
+    return _height;
+  }
+  /*!
+      @brief  Current rotation
+      @return 0 to 3
+  */
+  uint8_t getRotation(void) const {
+    return rotation;
+  }
+
+ protected:
+  int16_t WIDTH;        ///< Display width without rotation
+  int16_t HEIGHT;       ///< Display height without rotation
+  int16_t _width;       ///< Display width with rotation
+  int16_t _height;      ///< Display height with rotation
+  int16_t cursor_x;     ///< Text cursor X
+  int16_t cursor_y;     ///< Text cursor Y
+  uint16_t textcolor;   ///< Text foreground color
+  uint16_t textbgcolor; ///< Text background color
+  uint8_t textsize_x;   ///< Text magnification in X
+  uint8_t textsize_y;   ///< Text magnification in Y
+  uint8_t rotation;     ///< Display rotation (0 thru 3)
+  bool wrap;            ///< Wrap text at the right edge
+  bool _cp437;          ///< Use the correct CP437 table
+  GFXfont* gfxFont;     ///< Current font
+};
+
+#endif
@@ -0,0 +1,310 @@
+/*!
+ * @file Arduino.cpp
+ *
+ * Arduino core functions for host builds
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "Arduino.h"
+
+#include "RA8875_Emulator.h"
+
+HardwareSerial Serial;
+
+/// Simulated time in microseconds
+static unsigned long now;
+
+/**************************************************************************/
+/*!
+    @brief  Pin modes are not modelled
+*/
+/**************************************************************************/
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+/**************************************************************************/
+/*!
+    @brief  Forwards a pin change to the emulator, which watches CS
+*/
+/**************************************************************************/
+void digitalWrite(uint8_t pin, uint8_t val) {
+  RA8875Emu.pinWrite(pin, val);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads a pin level from the emulator. Every read moves the clock
+            on by a microsecond, so pin polls can time out.
+*/
+/**************************************************************************/
+int digitalRead(uint8_t pin) {
+  now++;
+  return RA8875Emu.pinRead(pin);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Advances the simulated clock by ms milliseconds
+*/
+/**************************************************************************/
+void delay(unsigned long ms) {
+  now += ms * 1000;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Advances the simulated clock by us microseconds
+*/
+/**************************************************************************/
+void delayMicroseconds(unsigned int us) {
+  now += us;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Simulated milliseconds since start
+*/
+/**************************************************************************/
+unsigned long millis(void) {
+  return now / 1000;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Simulated microseconds since start. Every call moves the clock
+            on by one so busy loops always make progress.
+*/
+/**************************************************************************/
+unsigned long micros(void) {
+  return now++;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Nothing to yield to on the host
+*/
+/**************************************************************************/
+void yield(void) {}
+
+/************************** Print and Stream ******************************/
+
+/**************************************************************************/
+/*!
+    @brief  Writes a buffer one byte at a time
+*/
+/**************************************************************************/
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--)
+    n += write(*buffer++);
+  return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a string
+*/
+/**************************************************************************/
+size_t Print::print(const char* s) {
+  return write((const uint8_t*)s, strlen(s));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a character
+*/
+/**************************************************************************/
+size_t Print::print(char c) {
+  return write((uint8_t)c);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a signed number
+*/
+/**************************************************************************/
+size_t Print::print(long n, int base) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), (base == HEX) ? "%lX" : "%ld", n);
+  return print(buf);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints an unsigned number
+*/
+/**************************************************************************/
+size_t Print::print(unsigned long n, int base) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), (base == HEX) ? "%lX" : "%lu", n);
+  return print(buf);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a signed number
+*/
+/**************************************************************************/
+size_t Print::print(int n, int base) {
+  return print((long)n, base);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints an unsigned number
+*/
+/**************************************************************************/
+size_t Print::print(unsigned int n, int base) {
+  return print((unsigned long)n, base);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a floating point number
+*/
+/**************************************************************************/
+size_t Print::print(double n, int digits) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return print(buf);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a line break
+*/
+/**************************************************************************/
+size_t Print::println(void) {
+  return print("\r\n");
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a string and a line break
+*/
+/**************************************************************************/
+size_t Print::println(const char* s) {
+  return print(s) + println();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a number and a line break
+*/
+/**************************************************************************/
+size_t Print::println(long n, int base) {
+  return print(n, base) + println();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a number and a line break
+*/
+/**************************************************************************/
+size_t Print::println(unsigned long n, int base) {
+  return print(n, base) + println();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a number and a line break
+*/
+/**************************************************************************/
+size_t Print::println(int n, int base) {
+  return print(n, base) + println();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a number and a line break
+*/
+/**************************************************************************/
+size_t Print::println(unsigned int n, int base) {
+  return print(n, base) + println();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prints a number and a line break
+*/
+/**************************************************************************/
+size_t Print::println(double n, int digits) {
+  return print(n, digits) + println();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Streams are read-only unless a subclass says otherwise
+*/
+/**************************************************************************/
+size_t Stream::write(uint8_t b) {
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads up to length bytes, stopping at the end of the data
+*/
+/**************************************************************************/
+size_t Stream::readBytes(uint8_t* buffer, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    int c = read();
+    if (c < 0)
+      break;
+    buffer[n++] = c;
+  }
+  return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads up to length bytes, stopping at the end of the data
+*/
+/**************************************************************************/
+size_t Stream::readBytes(char* buffer, size_t length) {
+  return readBytes((uint8_t*)buffer, length);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Baud rates are ignored
+*/
+/**************************************************************************/
+void HardwareSerial::begin(unsigned long baud) {}
+
+/**************************************************************************/
+/*!
+    @brief  Writes a byte to stdout
+*/
+/**************************************************************************/
+size_t HardwareSerial::write(uint8_t b) {
+  return fputc(b, stdout) == EOF ? 0 : 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Serial input is not modelled
+*/
+/**************************************************************************/
+int HardwareSerial::available(void) {
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Serial input is not modelled
+*/
+/**************************************************************************/
+int HardwareSerial::read(void) {
+  return -1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Serial input is not modelled
+*/
+/**************************************************************************/
+int HardwareSerial::peek(void) {
+  return -1;
+}
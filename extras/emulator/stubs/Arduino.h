@@ -0,0 +1,48 @@
+/*!
+ * @file Arduino.h
+ *
+ * Minimal Arduino core for building the library on a host. Pin and SPI
+ * traffic is routed to the RA8875 emulator, time is simulated: delay() and
+ * delayMicroseconds() only advance the clock returned by millis() and
+ * micros().
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#ifndef _ARDUINO_STUB_H
+#define _ARDUINO_STUB_H ///< File has been included
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool boolean; ///< Arduino boolean
+typedef uint8_t byte; ///< Arduino byte
+
+#define HIGH 0x1         ///< Pin level high
+#define LOW 0x0          ///< Pin level low
+#define INPUT 0x0        ///< Pin mode input
+#define OUTPUT 0x1       ///< Pin mode output
+#define INPUT_PULLUP 0x2 ///< Pin mode input with pull-up
+
+#define PROGMEM ///< Flash data is plain memory on the host
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))   ///< Read flash byte
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))  ///< Read flash word
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr)) ///< Read flash dword
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis(void);
+unsigned long micros(void);
+void yield(void);
+
+#include "Print.h"
+
+#endif
@@ -0,0 +1,91 @@
+/*!
+ * @file Print.h
+ *
+ * Print, Stream and Serial for host builds
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#ifndef _PRINT_STUB_H
+#define _PRINT_STUB_H ///< File has been included
+
+#include "Arduino.h"
+
+#define DEC 10 ///< Print numbers in decimal
+#define HEX 16 ///< Print numbers in hexadecimal
+
+/**************************************************************************/
+/*!
+    @brief  Byte sink with the Arduino print helpers
+*/
+/**************************************************************************/
+class Print {
+ public:
+  virtual ~Print() {}
+  /*!
+      @brief  Writes one byte
+      @param  b The byte
+      @return 1 if the byte was written
+  */
+  virtual size_t write(uint8_t b) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t print(const char* s);
+  size_t print(char c);
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t print(int n, int base = DEC);
+  size_t print(unsigned int n, int base = DEC);
+  size_t print(double n, int digits = 2);
+  size_t println(void);
+  size_t println(const char* s);
+  size_t println(long n, int base = DEC);
+  size_t println(unsigned long n, int base = DEC);
+  size_t println(int n, int base = DEC);
+  size_t println(unsigned int n, int base = DEC);
+  size_t println(double n, int digits = 2);
+};
+
+/**************************************************************************/
+/*!
+    @brief  Byte source, e.g. a File on an SD card
+*/
+/**************************************************************************/
+class Stream : public Print {
+ public:
+  /*!
+      @brief  Bytes that can be read without blocking
+      @return The byte count
+  */
+  virtual int available(void) = 0;
+  /*!
+      @brief  Reads one byte
+      @return The byte, or -1 at the end of the data
+  */
+  virtual int read(void) = 0;
+  /*!
+      @brief  Returns the next byte without consuming it
+      @return The byte, or -1 at the end of the data
+  */
+  virtual int peek(void) = 0;
+  size_t write(uint8_t b);
+  size_t readBytes(uint8_t* buffer, size_t length);
+  size_t readBytes(char* buffer, size_t length);
+};
+
+/**************************************************************************/
+/*!
+    @brief  Serial port that prints to stdout and never has input
+*/
+/**************************************************************************/
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long baud);
+  size_t write(uint8_t b);
+  int available(void);
+  int read(void);
+  int peek(void);
+};
+
+extern HardwareSerial Serial; ///< Prints to stdout
+
+#endif
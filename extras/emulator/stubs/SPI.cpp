@@ -0,0 +1,61 @@
+/*!
+ * @file SPI.cpp
+ *
+ * SPI bus for host builds, connected to the RA8875 emulator
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "SPI.h"
+
+#include "RA8875_Emulator.h"
+
+SPIClass SPI;
+
+/**************************************************************************/
+/*!
+    @brief  Nothing to set up on the host
+*/
+/**************************************************************************/
+void SPIClass::begin(void) {}
+
+/**************************************************************************/
+/*!
+    @brief  Claims the bus, the emulator rejects nested claims
+*/
+/**************************************************************************/
+void SPIClass::beginTransaction(SPISettings settings) {
+  RA8875Emu.beginTransaction();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Releases the bus
+*/
+/**************************************************************************/
+void SPIClass::endTransaction(void) {
+  RA8875Emu.endTransaction();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clocks one byte through the emulator
+*/
+/**************************************************************************/
+uint8_t SPIClass::transfer(uint8_t data) {
+  return RA8875Emu.transfer(data);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clocks a buffer through the emulator, replacing it with the
+            bytes read back
+*/
+/**************************************************************************/
+void SPIClass::transfer(void* buf, size_t count) {
+  uint8_t* p = (uint8_t*)buf;
+  while (count--) {
+    *p = RA8875Emu.transfer(*p);
+    p++;
+  }
+}
@@ -0,0 +1,52 @@
+/*!
+ * @file SPI.h
+ *
+ * SPI library for host builds. Every transfer is clocked through the RA8875
+ * emulator.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#ifndef _SPI_STUB_H
+#define _SPI_STUB_H ///< File has been included
+
+#include "Arduino.h"
+
+#define SPI_HAS_TRANSACTION 1 ///< beginTransaction() is available
+#define MSBFIRST 1            ///< Bit order
+#define SPI_MODE0 0x00        ///< Clock polarity and phase
+
+/**************************************************************************/
+/*!
+    @brief  Transaction settings, ignored by the emulator
+*/
+/**************************************************************************/
+class SPISettings {
+ public:
+  SPISettings(void) {}
+  /*!
+      @brief  Creates the settings
+      @param  clock    The bus clock in Hz
+      @param  bitOrder MSBFIRST
+      @param  dataMode SPI_MODE0
+  */
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {}
+};
+
+/**************************************************************************/
+/*!
+    @brief  SPI bus connected to the RA8875 emulator
+*/
+/**************************************************************************/
+class SPIClass {
+ public:
+  void begin(void);
+  void beginTransaction(SPISettings settings);
+  void endTransaction(void);
+  uint8_t transfer(uint8_t data);
+  void transfer(void* buf, size_t count);
+};
+
+extern SPIClass SPI; ///< The bus the library uses
+
+#endif
@@ -0,0 +1,128 @@
+/*!
+ * @file test.h
+ *
+ * Helpers shared by the emulator tests. Tests run from extras/emulator and
+ * print a line per failed check; main() returns testResult().
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#ifndef _RA8875_TEST_H
+#define _RA8875_TEST_H ///< File has been included
+
+#include "Adafruit_RA8875.h"
+#include "RA8875_Emulator.h"
+
+#define TEST_CS 10 ///< Chip select pin used by the tests
+#define TEST_RST 9 ///< Reset pin used by the tests
+
+/// Number of failed checks so far
+static int testFailures;
+
+/// Records a failed check with its location
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      testFailures++;                                                 \
+    }                                                                 \
+  } while (0)
+
+/**************************************************************************/
+/*!
+    @brief  A stream reading from a byte buffer
+*/
+/**************************************************************************/
+class BufferStream : public Stream {
+ public:
+  /*!
+      @brief  Reads from data
+      @param  data The bytes
+      @param  len  The number of bytes
+  */
+  BufferStream(const uint8_t* data, size_t len) : _data(data), _len(len) {
+    _pos = 0;
+  }
+  /*!
+      @brief  Bytes left to read
+      @return The byte count
+  */
+  int available(void) { return _len - _pos; }
+  /*!
+      @brief  Reads one byte
+      @return The byte, or -1 at the end of the data
+  */
+  int read(void) { return (_pos < _len) ? _data[_pos++] : -1; }
+  /*!
+      @brief  Returns the next byte without consuming it
+      @return The byte, or -1 at the end of the data
+  */
+  int peek(void) { return (_pos < _len) ? _data[_pos] : -1; }
+
+ private:
+  const uint8_t* _data;
+  size_t _len;
+  size_t _pos;
+};
+
+/**************************************************************************/
+/*!
+    @brief  Summary line and exit code for main()
+
+    @param name The test name
+
+    @return 0 if every check passed
+*/
+/**************************************************************************/
+static inline int testResult(const char* name) {
+  printf("%s: %s (%d failed checks)\n", name, testFailures ? "FAIL" : "ok",
+         testFailures);
+  return testFailures ? 1 : 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Compares an area of display memory with a golden PPM image. When
+            RA8875_UPDATE_GOLDEN is set in the environment the golden image
+            is rewritten instead. On a mismatch the actual image is written
+            to the build directory for inspection.
+
+    @param name  The image name, without directory or extension
+    @param layer The memory layer
+    @param x     Left edge of the area
+    @param y     Top edge of the area
+    @param w     Width of the area
+    @param h     Height of the area
+
+    @return True if the area matches the golden image
+*/
+/**************************************************************************/
+static inline bool matchGolden(const char* name, uint8_t layer, int16_t x,
+                               int16_t y, int16_t w, int16_t h) {
+  char golden[128], actual[128];
+  snprintf(golden, sizeof(golden), "test/golden/%s.ppm", name);
+  snprintf(actual, sizeof(actual), "build/%s.ppm", name);
+  if (getenv("RA8875_UPDATE_GOLDEN"))
+    return RA8875Emu.writePPM(golden, layer, x, y, w, h);
+
+  FILE* f = fopen(golden, "rb");
+  int gw = 0, gh = 0, max = 0;
+  bool same = f && fscanf(f, "P6 %d %d %d", &gw, &gh, &max) == 3 &&
+              fgetc(f) != EOF && gw == w && gh == h;
+  for (int16_t j = 0; same && j < h; j++) {
+    for (int16_t i = 0; same && i < w; i++) {
+      uint8_t want[3], got[3];
+      RA8875Emu.rgb(x + i, y + j, layer, got);
+      same = fread(want, 1, 3, f) == 3 && memcmp(want, got, 3) == 0;
+      if (!same)
+        printf("%s: first difference at %d,%d\n", name, i, j);
+    }
+  }
+  if (f)
+    fclose(f);
+  if (!same)
+    RA8875Emu.writePPM(actual, layer, x, y, w, h);
+  return same;
+}
+
+#endif
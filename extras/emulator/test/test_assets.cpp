@@ -0,0 +1,166 @@
+/*!
+ * @file test_assets.cpp
+ *
+ * Fills the asset cache past its capacity, both by area and by slot
+ * count, and checks that the least recently used assets are evicted and
+ * their space reused. Blits from the cache must show the cached pixels,
+ * with and without a transparent key color, and a rotation change must
+ * empty the cache.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define ASSET 16   ///< Side of the assets filling the small cache
+#define SMALL 4    ///< Side of the assets filling every slot
+#define KEY 0xF81F ///< Transparent key color in the asset pattern
+#define BG 0x0841  ///< Screen color under the blits
+
+/**************************************************************************/
+/*!
+    @brief  Pixel of the pattern of an asset, unique per asset and pixel
+            apart from the key color on every fifth diagonal
+*/
+/**************************************************************************/
+static uint16_t pattern(uint16_t id, int16_t x, int16_t y) {
+  if ((x + y) % 5 == 0)
+    return KEY;
+  return 0x0800 * (id & 0x0F) + y * ASSET + x + 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Caches a square asset with its pattern
+*/
+/**************************************************************************/
+static bool cache(Adafruit_RA8875& tft, uint16_t id, int16_t side) {
+  static uint16_t bmp[ASSET * ASSET];
+  for (int16_t y = 0; y < side; y++)
+    for (int16_t x = 0; x < side; x++)
+      bmp[y * side + x] = pattern(id, x, y);
+  return tft.cacheAsset(id, bmp, side, side);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Checks that a square of layer memory holds an asset pattern
+
+    @param id          The asset ID
+    @param layer       The memory layer
+    @param x           The x location in memory
+    @param y           The y location in memory
+    @param transparent Whether key colored pixels should show BG instead
+*/
+/**************************************************************************/
+static void checkAsset(uint16_t id, uint8_t layer, int16_t x, int16_t y,
+                       bool transparent) {
+  int16_t bad = 0;
+  for (int16_t j = 0; j < ASSET; j++) {
+    for (int16_t i = 0; i < ASSET; i++) {
+      uint16_t want = pattern(id, i, j);
+      if (transparent && (want == KEY))
+        want = BG;
+      uint16_t got = RA8875Emu.pixel(x + i, y + j, layer);
+      if ((got != want) && (bad++ < 4))
+        printf("asset %d on layer %d: pixel %d,%d is %04X, want %04X\n", id,
+               layer, i, j, got, want);
+    }
+  }
+  CHECK(bad == 0);
+}
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_480x272));
+  tft.graphicsMode();
+  CHECK(tft.enableLayers(true));
+
+  /* Eight assets fill a 64x32 area, row by row from the top-left */
+  CHECK(tft.setAssetCache(RA8875_LAYER2, 0, 0, 4 * ASSET, 2 * ASSET));
+  for (uint16_t id = 1; id <= 8; id++)
+    CHECK(cache(tft, id, ASSET));
+  for (uint16_t id = 1; id <= 8; id++) {
+    CHECK(tft.isCached(id));
+    checkAsset(id, 1, ((id - 1) % 4) * ASSET, ((id - 1) / 4) * ASSET, false);
+  }
+
+  /* Blits show the cached pixels, the key color leaves the screen alone */
+  tft.fillScreen(BG);
+  CHECK(tft.drawCached(1, 100, 50));
+  checkAsset(1, 0, 100, 50, false);
+  CHECK(tft.drawCached(3, 200, 50, KEY));
+  checkAsset(3, 0, 200, 50, true);
+  CHECK(!tft.drawCached(42, 0, 0));
+
+  /* Asset 2 is now the least recently used and makes room for asset 9 */
+  CHECK(cache(tft, 9, ASSET));
+  CHECK(!tft.isCached(2));
+  for (uint16_t id = 1; id <= 9; id++)
+    CHECK(tft.isCached(id) == (id != 2));
+  checkAsset(9, 1, ASSET, 0, false);
+  CHECK(tft.drawCached(9, 300, 100));
+  checkAsset(9, 0, 300, 100, false);
+
+  /* Caching an ID again sends nothing and is not a use, only blits are */
+  RA8875Emu.clearStats();
+  CHECK(cache(tft, 4, ASSET));
+  CHECK(RA8875Emu.stats().frames == 0);
+  CHECK(cache(tft, 10, ASSET));
+  CHECK(!tft.isCached(4) && tft.isCached(5));
+  checkAsset(10, 1, 3 * ASSET, 0, false);
+
+  /* An evicted asset leaves a gap for the next one */
+  tft.evictAsset(7);
+  CHECK(!tft.isCached(7));
+  CHECK(cache(tft, 11, ASSET));
+  CHECK(tft.isCached(6) && tft.isCached(8));
+  checkAsset(11, 1, 2 * ASSET, ASSET, false);
+
+  /* Assets larger than the area never fit. A wide one evicts the two
+     least recently used neighbours, 5 and 6, to make room. */
+  int16_t ax, ay;
+  CHECK(!tft.allocAsset(12, 4 * ASSET + 1, ASSET, &ax, &ay));
+  CHECK(tft.isCached(5));
+  CHECK(tft.allocAsset(12, 2 * ASSET, ASSET, &ax, &ay));
+  CHECK(tft.isCached(12) && (ax == 0) && (ay == ASSET));
+  CHECK(!tft.isCached(5) && !tft.isCached(6) && tft.isCached(8));
+
+  /* With room to spare the slot count is the limit */
+  CHECK(tft.setAssetCache(RA8875_LAYER2, 0, 0, 480, 272));
+  CHECK(!tft.isCached(1));
+  for (uint16_t id = 0; id < RA8875_ASSET_SLOTS + 4; id++)
+    CHECK(cache(tft, 100 + id, SMALL));
+  for (uint16_t id = 0; id < RA8875_ASSET_SLOTS + 4; id++)
+    CHECK(tft.isCached(100 + id) == (id >= 4));
+
+  /* A rotation change empties the cache */
+  tft.setRotation(1);
+  for (uint16_t id = 0; id < RA8875_ASSET_SLOTS + 4; id++)
+    CHECK(!tft.isCached(100 + id));
+  CHECK(!tft.drawCached(110, 0, 0));
+
+  /* Blits at the new rotation read back the asset */
+  static uint16_t got[ASSET * ASSET];
+  tft.fillScreen(BG);
+  CHECK(cache(tft, 1, ASSET));
+  CHECK(tft.drawCached(1, 30, 40, KEY));
+  CHECK(tft.readPixels(30, 40, ASSET, ASSET, got));
+  int16_t bad = 0;
+  for (int16_t j = 0; j < ASSET; j++) {
+    for (int16_t i = 0; i < ASSET; i++) {
+      uint16_t want = pattern(1, i, j);
+      if (want == KEY)
+        want = BG;
+      if (got[j * ASSET + i] != want)
+        bad++;
+    }
+  }
+  CHECK(bad == 0);
+
+  tft.clearAssetCache();
+  CHECK(!tft.isCached(1));
+
+  return testResult("test_assets");
+}
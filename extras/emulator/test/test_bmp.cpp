@@ -0,0 +1,258 @@
+/*!
+ * @file test_bmp.cpp
+ *
+ * Draws BMP files with drawBMP() and raw RGB565 data with drawRaw565()
+ * and compares display memory with the known pixels. A hand-assembled
+ * 24-bit file pins the bottom-up row order, the blue-first byte order and
+ * the row padding. Generated files cover 24-bit, XRGB1555 and RGB565
+ * bitfields, bottom-up and top-down, whole and clipped by the screen
+ * edge, and files that are cut short or not supported.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define IMG_W 13      ///< Generated image width, odd for row padding
+#define IMG_H 9       ///< Generated image height
+#define BG 0x0841     ///< Screen color around the images
+#define FILE_MAX 1024 ///< Largest generated file in bytes
+
+/**************************************************************************/
+/*!
+    @brief  Stores a little-endian 16-bit value
+*/
+/**************************************************************************/
+static void put16(uint8_t* p, uint16_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stores a little-endian 32-bit value
+*/
+/**************************************************************************/
+static void put32(uint8_t* p, uint32_t v) {
+  put16(p, v);
+  put16(p + 2, v >> 16);
+}
+
+/**************************************************************************/
+/*!
+    @brief  The 8-bit RGB color of a generated image pixel
+*/
+/**************************************************************************/
+static void source(int16_t x, int16_t y, uint8_t* rgb) {
+  rgb[0] = x * 19 + y * 7;
+  rgb[1] = 255 - x * 11 - y * 13;
+  rgb[2] = (x * y * 29) ^ 0x5A;
+}
+
+/**************************************************************************/
+/*!
+    @brief  The RGB565 color a generated image pixel is drawn with
+
+    @param x     The pixel column
+    @param y     The pixel row
+    @param depth 24 or 16
+    @param rgb16 For 16-bit files, whether they hold RGB565 instead of
+                 XRGB1555
+*/
+/**************************************************************************/
+static uint16_t expected(int16_t x, int16_t y, uint8_t depth, bool rgb16) {
+  uint8_t c[3];
+  source(x, y, c);
+  if ((depth == 16) && !rgb16) {
+    /* Five bits of green, widened by repeating the top bit */
+    uint8_t g = c[1] >> 3;
+    return ((c[0] & 0xF8) << 8) | (g << 6) | ((g >> 4) << 5) | (c[2] >> 3);
+  }
+  return ((c[0] & 0xF8) << 8) | ((c[1] & 0xFC) << 3) | (c[2] >> 3);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes a BMP file of the generated image
+
+    @param out     The buffer for the file
+    @param depth   24 or 16
+    @param rgb16   For 16-bit files, whether to use RGB565 bitfields
+    @param topDown Whether to store the top row first
+
+    @return The file size
+*/
+/**************************************************************************/
+static size_t makeBmp(uint8_t* out, uint8_t depth, bool rgb16, bool topDown) {
+  uint32_t stride = ((uint32_t)IMG_W * (depth / 8) + 3) & ~3UL;
+  uint32_t offset = 54 + (rgb16 ? 12 : 0);
+  size_t size = offset + stride * IMG_H;
+
+  memset(out, 0, size);
+  out[0] = 'B';
+  out[1] = 'M';
+  put32(&out[2], size);
+  put32(&out[10], offset);
+  put32(&out[14], 40);
+  put32(&out[18], IMG_W);
+  put32(&out[22], topDown ? -IMG_H : IMG_H);
+  put16(&out[26], 1);
+  put16(&out[28], depth);
+  put32(&out[30], rgb16 ? 3 : 0);
+  put32(&out[34], stride * IMG_H);
+  if (rgb16) {
+    put32(&out[54], 0xF800);
+    put32(&out[58], 0x07E0);
+    put32(&out[62], 0x001F);
+  }
+
+  for (int16_t y = 0; y < IMG_H; y++) {
+    uint8_t* p = out + offset + stride * (topDown ? y : IMG_H - 1 - y);
+    for (int16_t x = 0; x < IMG_W; x++) {
+      uint8_t c[3];
+      source(x, y, c);
+      if (depth == 24) {
+        *p++ = c[2];
+        *p++ = c[1];
+        *p++ = c[0];
+      } else if (rgb16) {
+        put16(p, ((c[0] & 0xF8) << 8) | ((c[1] & 0xFC) << 3) | (c[2] >> 3));
+        p += 2;
+      } else {
+        put16(p, ((c[0] & 0xF8) << 7) | ((c[1] & 0xF8) << 2) | (c[2] >> 3));
+        p += 2;
+      }
+    }
+  }
+  return size;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Compares the drawn generated image, and the background pixels
+            around it, with the expected colors
+*/
+/**************************************************************************/
+static void compare(int16_t x, int16_t y, uint8_t depth, bool rgb16,
+                    const char* name) {
+  int16_t bad = 0;
+  for (int16_t j = -1; j <= IMG_H; j++) {
+    for (int16_t i = -1; i <= IMG_W; i++) {
+      int16_t sx = x + i, sy = y + j;
+      if ((sx < 0) || (sy < 0) || (sx >= RA8875Emu.width()) ||
+          (sy >= RA8875Emu.height()))
+        continue;
+      bool in = (i >= 0) && (j >= 0) && (i < IMG_W) && (j < IMG_H);
+      uint16_t want = in ? expected(i, j, depth, rgb16) : BG;
+      uint16_t got = RA8875Emu.pixel(sx, sy);
+      if ((got != want) && (bad++ < 4))
+        printf("%s: pixel %d,%d is %04X, want %04X\n", name, i, j, got, want);
+    }
+  }
+  CHECK(bad == 0);
+}
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_480x272));
+  tft.graphicsMode();
+
+  /* 2x2, 24-bit, bottom-up: red and green over blue and white */
+  static const uint8_t tiny[] = {
+      'B',  'M', 70,   0,    0,    0,    0, 0, 0, 0, 54, 0, 0, 0,  // File
+      40,   0,   0,    0,    2,    0,    0, 0, 2, 0, 0,  0,        // Size, w, h
+      1,    0,   24,   0,    0,    0,    0, 0,                     // 24-bit
+      16,   0,   0,    0,    0,    0,    0, 0, 0, 0, 0,  0,        // Data size
+      0,    0,   0,    0,    0,    0,    0, 0,                     // Colors
+      0xFF, 0,   0,    0xFF, 0xFF, 0xFF, 0, 0,  // Blue, white, padding
+      0,    0,   0xFF, 0,    0xFF, 0,    0, 0}; // Red, green, padding
+  tft.fillScreen(BG);
+  BufferStream tinyIn(tiny, sizeof(tiny));
+  CHECK(tft.drawBMP(tinyIn, 10, 20));
+  CHECK(RA8875Emu.pixel(10, 20) == RA8875_RED);
+  CHECK(RA8875Emu.pixel(11, 20) == RA8875_GREEN);
+  CHECK(RA8875Emu.pixel(10, 21) == RA8875_BLUE);
+  CHECK(RA8875Emu.pixel(11, 21) == RA8875_WHITE);
+  CHECK(RA8875Emu.pixel(12, 20) == BG && RA8875Emu.pixel(10, 22) == BG);
+
+  static const struct {
+    uint8_t depth;
+    bool rgb16;
+    bool topDown;
+    const char* name;
+  } kinds[] = {{24, false, false, "24-bit"},
+               {24, false, true, "24-bit top-down"},
+               {16, false, false, "XRGB1555"},
+               {16, true, false, "RGB565 bitfields"},
+               {16, true, true, "RGB565 bitfields top-down"}};
+  static uint8_t file[FILE_MAX];
+  for (uint8_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++) {
+    size_t len = makeBmp(file, kinds[k].depth, kinds[k].rgb16,
+                         kinds[k].topDown);
+    CHECK(len <= FILE_MAX);
+
+    tft.fillScreen(BG);
+    BufferStream in(file, len);
+    CHECK(tft.drawBMP(in, 100, 50));
+    compare(100, 50, kinds[k].depth, kinds[k].rgb16, kinds[k].name);
+
+    /* Clipped by the top-left and bottom-right screen corners */
+    tft.fillScreen(BG);
+    BufferStream topLeft(file, len);
+    CHECK(tft.drawBMP(topLeft, -4, -3));
+    compare(-4, -3, kinds[k].depth, kinds[k].rgb16, kinds[k].name);
+    tft.fillScreen(BG);
+    BufferStream bottomRight(file, len);
+    CHECK(tft.drawBMP(bottomRight, 480 - 5, 272 - 4));
+    compare(480 - 5, 272 - 4, kinds[k].depth, kinds[k].rgb16, kinds[k].name);
+
+    /* Pixel data cut short, and a header cut short */
+    BufferStream cut(file, len - 8);
+    CHECK(!tft.drawBMP(cut, 100, 50));
+    BufferStream header(file, 40);
+    CHECK(!tft.drawBMP(header, 100, 50));
+  }
+
+  /* Unsupported depths, compressions and channel masks are refused */
+  size_t len = makeBmp(file, 24, false, false);
+  put16(&file[28], 8);
+  BufferStream depth8(file, len);
+  CHECK(!tft.drawBMP(depth8, 100, 50));
+  len = makeBmp(file, 16, true, false);
+  put32(&file[54], 0x7C00);
+  BufferStream masks(file, len);
+  CHECK(!tft.drawBMP(masks, 100, 50));
+  file[0] = 'X';
+  BufferStream magic(file, len);
+  CHECK(!tft.drawBMP(magic, 100, 50));
+
+  /* Raw RGB565, both byte orders */
+  static uint8_t raw[IMG_W * IMG_H * 2];
+  for (uint8_t bigEndian = 0; bigEndian < 2; bigEndian++) {
+    for (int16_t y = 0; y < IMG_H; y++) {
+      for (int16_t x = 0; x < IMG_W; x++) {
+        uint16_t c = expected(x, y, 24, false);
+        uint8_t* p = raw + (y * IMG_W + x) * 2;
+        p[bigEndian ? 1 : 0] = c;
+        p[bigEndian ? 0 : 1] = c >> 8;
+      }
+    }
+    tft.fillScreen(BG);
+    BufferStream in(raw, sizeof(raw));
+    CHECK(tft.drawRaw565(in, 30, 60, IMG_W, IMG_H, bigEndian));
+    compare(30, 60, 24, false, bigEndian ? "raw BE" : "raw LE");
+
+    tft.fillScreen(BG);
+    BufferStream clipped(raw, sizeof(raw));
+    CHECK(tft.drawRaw565(clipped, 480 - 6, -2, IMG_W, IMG_H, bigEndian));
+    compare(480 - 6, -2, 24, false, bigEndian ? "raw BE edge" : "raw LE edge");
+
+    BufferStream cut(raw, sizeof(raw) - 1);
+    CHECK(!tft.drawRaw565(cut, 30, 60, IMG_W, IMG_H, bigEndian));
+  }
+  BufferStream none(raw, sizeof(raw));
+  CHECK(!tft.drawRaw565(none, 30, 60, 0, IMG_H));
+
+  return testResult("test_bmp");
+}
@@ -0,0 +1,79 @@
+/*!
+ * @file test_dither.cpp
+ *
+ * Checks that the 8bpp ordered dither follows the screen position of each
+ * pixel. bteWrite() at every rotation must give the same pixels as
+ * drawPixel(), also when a pixel run batched by writePixel() is still
+ * pending and gets flushed on the way.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define GRAD_W 21 ///< Gradient width, not a multiple of the dither size
+#define GRAD_H 11 ///< Gradient height
+#define GRAD_X 33 ///< Gradient x location
+#define GRAD_Y 18 ///< Gradient y location
+
+/**************************************************************************/
+/*!
+    @brief  Reads the gradient area back and compares it with a reference
+
+    @param tft  The display
+    @param ref  The reference pixels, or NULL to fill them in
+    @param name The case name for failure messages
+*/
+/**************************************************************************/
+static void compare(Adafruit_RA8875& tft, uint16_t* ref, const char* name) {
+  static uint16_t got[GRAD_W * GRAD_H];
+  CHECK(tft.readPixels(GRAD_X, GRAD_Y, GRAD_W, GRAD_H, got));
+  int16_t bad = 0;
+  for (int16_t i = 0; i < GRAD_W * GRAD_H; i++) {
+    if ((got[i] != ref[i]) && (bad++ < 4))
+      printf("rotation %d, %s: pixel %d,%d is %04X, want %04X\n",
+             tft.getRotation(), name, i % GRAD_W, i / GRAD_W, got[i], ref[i]);
+  }
+  CHECK(bad == 0);
+}
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_480x272));
+  tft.graphicsMode();
+  CHECK(tft.setColorDepth(8));
+  tft.setDither(true);
+
+  /* Smooth ramps, so neighbouring thresholds round differently */
+  static uint16_t grad[GRAD_W * GRAD_H], ref[GRAD_W * GRAD_H];
+  for (int16_t y = 0; y < GRAD_H; y++)
+    for (int16_t x = 0; x < GRAD_W; x++)
+      grad[y * GRAD_W + x] = ((x + 3) << 11) | ((y * 4 + x) << 5) | (y + 7);
+
+  for (uint8_t r = 0; r < 4; r++) {
+    tft.setRotation(r);
+
+    /* drawPixel() dithers each pixel at its own position */
+    tft.fillScreen(RA8875_BLACK);
+    for (int16_t y = 0; y < GRAD_H; y++)
+      for (int16_t x = 0; x < GRAD_W; x++)
+        tft.drawPixel(GRAD_X + x, GRAD_Y + y, grad[y * GRAD_W + x]);
+    CHECK(tft.readPixels(GRAD_X, GRAD_Y, GRAD_W, GRAD_H, ref));
+
+    tft.fillScreen(RA8875_BLACK);
+    tft.bteWrite(GRAD_X, GRAD_Y, GRAD_W, GRAD_H, grad, RA8875_BTE_ROP_S);
+    compare(tft, ref, "bteWrite");
+
+    /* A pending run elsewhere is flushed before the write starts */
+    tft.fillScreen(RA8875_BLACK);
+    tft.startWrite();
+    tft.writePixel(GRAD_X + 2 * GRAD_W + 1, GRAD_Y + 3, 0x7BEF);
+    tft.writePixel(GRAD_X + 2 * GRAD_W + 2, GRAD_Y + 3, 0x7BEF);
+    tft.bteWrite(GRAD_X, GRAD_Y, GRAD_W, GRAD_H, grad, RA8875_BTE_ROP_S);
+    tft.endWrite();
+    compare(tft, ref, "bteWrite after a run");
+  }
+
+  return testResult("test_dither");
+}
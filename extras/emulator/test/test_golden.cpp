@@ -0,0 +1,74 @@
+/*!
+ * @file test_golden.cpp
+ *
+ * Draws a scene with every draw engine primitive, clipping, streamed
+ * bitmaps, BTE color expansion and text mode, and compares the result with
+ * test/golden/primitives.ppm. Regenerate the image with "make golden" after
+ * an intended change and check the new one by eye.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_480x272));
+  CHECK(RA8875Emu.width() == 480 && RA8875Emu.height() == 272);
+
+  tft.fillScreen(0x18E3);
+
+  /* Lines in all octants */
+  for (int16_t i = 0; i < 8; i++) {
+    static const int8_t dx[8] = {18, 18, 6, -6, -18, -18, -6, 6};
+    static const int8_t dy[8] = {6, -6, -18, -18, -6, 6, 18, 18};
+    tft.drawLine(20, 20, 20 + dx[i], 20 + dy[i], 0xFFE0);
+  }
+
+  /* Rectangles and triangles, outline and filled */
+  tft.drawRect(44, 4, 30, 20, RA8875_WHITE);
+  tft.fillRect(48, 8, 22, 12, RA8875_RED);
+  tft.drawTriangle(80, 36, 96, 4, 112, 30, RA8875_GREEN);
+  tft.fillTriangle(116, 4, 156, 14, 124, 36, RA8875_BLUE);
+
+  /* Circles, ellipses, curves and rounded rectangles */
+  tft.drawCircle(16, 58, 12, RA8875_CYAN);
+  tft.fillCircle(44, 58, 10, RA8875_MAGENTA);
+  tft.drawEllipse(80, 58, 18, 8, RA8875_WHITE);
+  tft.fillEllipse(120, 58, 8, 14, RA8875_YELLOW);
+  for (uint8_t part = 0; part < 4; part++)
+    tft.drawCurve(146, 58, 6 + part * 2, 10, part, RA8875_GREEN);
+  tft.drawRoundRect(4, 78, 40, 24, 6, RA8875_WHITE);
+  tft.fillRoundRect(48, 78, 40, 24, 8, 0xFD20);
+
+  /* A filled circle clipped by the active window */
+  tft.setClipRect(96, 80, 30, 20);
+  tft.fillCircle(110, 90, 16, RA8875_RED);
+  tft.resetClip();
+
+  /* Streamed RGB bitmap and BTE color expansion */
+  uint16_t ramp[16 * 12];
+  for (int16_t j = 0; j < 12; j++)
+    for (int16_t i = 0; i < 16; i++)
+      ramp[j * 16 + i] = ((i * 2) << 11) | ((j * 5) << 5) | (31 - i * 2);
+  tft.drawRGBBitmap(132, 80, ramp, 16, 12);
+  static const uint8_t checker[2 * 10] = {0xCC, 0xC0, 0xCC, 0xC0, 0x33, 0x00,
+                                          0x33, 0x00, 0xCC, 0xC0, 0xCC, 0xC0,
+                                          0x33, 0x00, 0x33, 0x00, 0xCC, 0xC0,
+                                          0xCC, 0xC0};
+  tft.drawMonoBitmap(132, 96, 10, 10, checker, RA8875_WHITE, RA8875_BLUE);
+  tft.drawMonoBitmap(144, 96, 10, 10, checker, RA8875_YELLOW);
+
+  /* Text mode, drawn as blocks since the font ROM is not modelled */
+  tft.textMode();
+  tft.textSetCursor(4, 103);
+  tft.textColor(RA8875_WHITE, RA8875_RED);
+  tft.textWrite("Hi ");
+  tft.textTransparent(RA8875_GREEN);
+  tft.textWrite("RA");
+  tft.graphicsMode();
+
+  CHECK(matchGolden("primitives", 0, 0, 0, 160, 120));
+  return testResult("test_golden");
+}
@@ -0,0 +1,363 @@
+/*!
+ * @file test_jpeg.cpp
+ *
+ * Draws small baseline JPEG files with drawJPEG() at every rotation and
+ * compares a hash of the pixels read back with the hash of the libjpeg
+ * decode (JDCT_ISLOW, no fancy upsampling) of the same file. Also checks
+ * drawing partly off screen, truncated files and images as wide as the
+ * decoder allows.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define BG 0x0841     ///< Background color around the images
+#define IMG_X 11      ///< Image x location
+#define IMG_Y 13      ///< Image y location
+#define FLAT_MAX 4096 ///< Largest generated flat image in bytes
+
+/// 27x19, 4:2:0 sampling
+static const uint8_t jpeg420[] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43,
+    0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08, 0x07, 0x07, 0x07, 0x09,
+    0x09, 0x08, 0x0A, 0x0C, 0x14, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x19, 0x12,
+    0x13, 0x0F, 0x14, 0x1D, 0x1A, 0x1F, 0x1E, 0x1D, 0x1A, 0x1C, 0x1C, 0x20,
+    0x24, 0x2E, 0x27, 0x20, 0x22, 0x2C, 0x23, 0x1C, 0x1C, 0x28, 0x37, 0x29,
+    0x2C, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1F, 0x27, 0x39, 0x3D, 0x38, 0x32,
+    0x3C, 0x2E, 0x33, 0x34, 0x32, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x09, 0x09,
+    0x09, 0x0C, 0x0B, 0x0C, 0x18, 0x0D, 0x0D, 0x18, 0x32, 0x21, 0x1C, 0x21,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0x13, 0x00, 0x1B, 0x03,
+    0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00,
+    0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00,
+    0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+    0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24,
+    0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25,
+    0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86,
+    0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6,
+    0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9,
+    0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1,
+    0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00,
+    0x1F, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+    0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31,
+    0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+    0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15,
+    0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18,
+    0x19, 0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4,
+    0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7,
+    0xD8, 0xD9, 0xDA, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA,
+    0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xDA, 0x00,
+    0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xE7,
+    0xEC, 0x34, 0xA3, 0x19, 0x17, 0x37, 0x0E, 0x59, 0xBE, 0xF0, 0x04, 0xEE,
+    0xE7, 0xD4, 0xF1, 0xD6, 0x92, 0xF7, 0x54, 0x77, 0x63, 0x6D, 0x65, 0xF2,
+    0x93, 0xC6, 0xF0, 0x70, 0x5B, 0xB6, 0x07, 0x3C, 0x7F, 0x9E, 0x95, 0x5E,
+    0xF2, 0xF6, 0xE2, 0xFD, 0xFE, 0xCF, 0x6F, 0x1C, 0x82, 0x26, 0x04, 0x88,
+    0xD3, 0xF8, 0x8F, 0xBD, 0x54, 0x49, 0x5E, 0x04, 0x64, 0x28, 0xA2, 0x42,
+    0x39, 0x62, 0x40, 0x2A, 0x3B, 0x8C, 0x7A, 0x9A, 0xC9, 0x45, 0xBD, 0x64,
+    0x6A, 0xE5, 0xD0, 0x7D, 0xA4, 0x42, 0xC6, 0xFB, 0xFD, 0x2A, 0x22, 0x98,
+    0xE0, 0x17, 0xFE, 0x06, 0xFE, 0xF6, 0x3B, 0xF3, 0xEB, 0x57, 0xD7, 0x44,
+    0xBD, 0x9C, 0x79, 0xA6, 0x78, 0x5B, 0x7F, 0xCD, 0xB8, 0x92, 0x73, 0xEF,
+    0xC5, 0x52, 0x6D, 0xF7, 0xD6, 0xA0, 0x10, 0xCD, 0x71, 0x6C, 0x0F, 0x20,
+    0xFD, 0xE4, 0x35, 0x00, 0xDC, 0x00, 0x1F, 0x69, 0x91, 0x30, 0x3E, 0xEA,
+    0x17, 0x20, 0x7D, 0x08, 0x22, 0xAA, 0xCD, 0x88, 0xB2, 0x99, 0x4D, 0x1C,
+    0x6D, 0x24, 0x6F, 0xB9, 0xD8, 0xD8, 0x3D, 0x57, 0x1D, 0x2A, 0x3B, 0x99,
+    0x5D, 0xAD, 0xED, 0x0B, 0x1C, 0x97, 0x04, 0x31, 0x20, 0x72, 0x32, 0x7F,
+    0xC0, 0x51, 0x45, 0x4A, 0xDC, 0x11, 0x1E, 0xF6, 0x85, 0xD9, 0xE3, 0x3B,
+    0x59, 0x70, 0x41, 0x1F, 0x51, 0xFE, 0x26, 0x8B, 0xF8, 0x90, 0x5F, 0x4B,
+    0x80, 0x40, 0xCE, 0x70, 0x18, 0x81, 0x45, 0x15, 0xA0, 0x8F, 0xFF, 0xD9};
+
+/// 13x11, 4:4:4 sampling
+static const uint8_t jpeg444[] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43,
+    0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04,
+    0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0A, 0x07,
+    0x07, 0x06, 0x08, 0x0C, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 0x0B, 0x0B, 0x0D,
+    0x0E, 0x12, 0x10, 0x0D, 0x0E, 0x11, 0x0E, 0x0B, 0x0B, 0x10, 0x16, 0x10,
+    0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0C, 0x0F, 0x17, 0x18, 0x16, 0x14,
+    0x18, 0x12, 0x14, 0x15, 0x14, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x03, 0x04,
+    0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0D, 0x0B, 0x0D,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0x0B, 0x00, 0x0D, 0x03,
+    0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00,
+    0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00,
+    0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+    0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24,
+    0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25,
+    0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86,
+    0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6,
+    0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9,
+    0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1,
+    0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00,
+    0x1F, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+    0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31,
+    0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+    0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15,
+    0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18,
+    0x19, 0x1A, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4,
+    0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7,
+    0xD8, 0xD9, 0xDA, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA,
+    0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xDA, 0x00,
+    0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF9,
+    0x4A, 0x7C, 0x32, 0x82, 0xD0, 0x5A, 0x5F, 0x42, 0xAA, 0x40, 0x95, 0x64,
+    0xF9, 0x99, 0x79, 0x25, 0x76, 0xB7, 0x5C, 0x71, 0xC7, 0x07, 0x1C, 0xD0,
+    0x03, 0x5F, 0x55, 0x5F, 0x0F, 0xB1, 0x8C, 0xCF, 0x25, 0xB3, 0x48, 0x4B,
+    0x15, 0x8E, 0xDC, 0xCA, 0x49, 0x07, 0x1C, 0xFC, 0xA7, 0x03, 0x8E, 0x06,
+    0x07, 0xF8, 0x5A, 0x8D, 0xC6, 0x25, 0xCD, 0xDC, 0xF1, 0xDB, 0x5F, 0xBA,
+    0xCC, 0xEA, 0xD1, 0xDA, 0xC9, 0x2A, 0x61, 0x8F, 0xCA, 0xCB, 0x27, 0xCB,
+    0x8F, 0x4C, 0x7A, 0x74, 0xE0, 0x7A, 0x56, 0x62, 0x3A, 0x0D, 0x37, 0x42,
+    0xB0, 0x4F, 0x12, 0x6A, 0x56, 0x82, 0xD9, 0x05, 0xBC, 0x56, 0x76, 0x53,
+    0x22, 0xF3, 0x90, 0xD2, 0x23, 0x33, 0x9C, 0xF5, 0xE4, 0xF3, 0x8E, 0x83,
+    0xB6, 0x2B, 0xA6, 0x3B, 0x0D, 0x1F, 0xFF, 0xD9};
+
+/// 21x17, 4:2:2 sampling, optimized Huffman tables, a restart every MCU
+static const uint8_t jpeg422r[] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43,
+    0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08, 0x07, 0x07, 0x07, 0x09,
+    0x09, 0x08, 0x0A, 0x0C, 0x14, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x19, 0x12,
+    0x13, 0x0F, 0x14, 0x1D, 0x1A, 0x1F, 0x1E, 0x1D, 0x1A, 0x1C, 0x1C, 0x20,
+    0x24, 0x2E, 0x27, 0x20, 0x22, 0x2C, 0x23, 0x1C, 0x1C, 0x28, 0x37, 0x29,
+    0x2C, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1F, 0x27, 0x39, 0x3D, 0x38, 0x32,
+    0x3C, 0x2E, 0x33, 0x34, 0x32, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x09, 0x09,
+    0x09, 0x0C, 0x0B, 0x0C, 0x18, 0x0D, 0x0D, 0x18, 0x32, 0x21, 0x1C, 0x21,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0x11, 0x00, 0x15, 0x03,
+    0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00,
+    0x18, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x04, 0x06, 0xFF,
+    0xC4, 0x00, 0x26, 0x10, 0x00, 0x01, 0x03, 0x01, 0x05, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x11, 0x21, 0x32, 0x34, 0x12, 0x13, 0x41, 0x72, 0x73, 0x81,
+    0x91, 0xA1, 0xB2, 0xFF, 0xC4, 0x00, 0x16, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x02, 0x04, 0xFF, 0xC4, 0x00, 0x16, 0x11, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x01, 0xFF, 0xDD, 0x00, 0x04, 0x00, 0x01, 0xFF, 0xDA, 0x00,
+    0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0x73,
+    0x20, 0x56, 0xFF, 0xD0, 0x72, 0x5B, 0xF8, 0x27, 0xBB, 0x88, 0x1A, 0xB7,
+    0xFF, 0xD1, 0x73, 0x31, 0x91, 0xED, 0x8D, 0xAA, 0xE7, 0x2E, 0x09, 0x8A,
+    0x80, 0xB9, 0x5F, 0xFF, 0xD2, 0x61, 0x65, 0x43, 0xAD, 0x08, 0xD2, 0x5A,
+    0x7A, 0xAD, 0xC3, 0x51, 0x6E, 0xC8, 0x8E, 0xDA, 0xC1, 0x3C, 0x11, 0x9A,
+    0x96, 0x3F, 0xFF, 0xD3, 0x74, 0x6E, 0x6E, 0xE6, 0xA4, 0xDA, 0xAA, 0x4E,
+    0x63, 0x39, 0x31, 0xFF, 0xD4, 0xEC, 0xAD, 0x7D, 0x4B, 0xFA, 0xB2, 0x7D,
+    0x11, 0x90, 0xEF, 0xFF, 0xD9};
+
+/**************************************************************************/
+/*!
+    @brief  A test file and the hash of its reference decode
+*/
+/**************************************************************************/
+typedef struct {
+  const char* name;    ///< Name for failure messages
+  const uint8_t* data; ///< The JPEG file
+  size_t len;          ///< The file size
+  int16_t w;           ///< The image width
+  int16_t h;           ///< The image height
+  uint32_t hash;       ///< FNV-1a of the RGB565 pixels, high byte first
+} tsJpegFile_t;
+
+/**************************************************************************/
+/*!
+    @brief  FNV-1a hash of an area of the screen, read back row by row
+*/
+/**************************************************************************/
+static uint32_t screenHash(Adafruit_RA8875& tft, int16_t x, int16_t y,
+                           int16_t w, int16_t h) {
+  static uint16_t px[64 * 64];
+  uint32_t hash = 2166136261UL;
+  if (!tft.readPixels(x, y, w, h, px))
+    return 0;
+  for (int32_t i = 0; i < (int32_t)w * h; i++) {
+    hash = (hash ^ (px[i] >> 8)) * 16777619UL;
+    hash = (hash ^ (px[i] & 0xFF)) * 16777619UL;
+  }
+  return hash;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Makes a valid 4:2:0 JPEG file of a flat mid gray. Every block
+            is a zero DC difference and an end of block, each a one bit
+            code, so the scan is 12 zero bits per MCU.
+
+    @param out The buffer for the file
+    @param max The buffer size, longer files are cut short
+    @param w   The image width
+    @param h   The image height
+
+    @return The file size
+*/
+/**************************************************************************/
+static size_t flatJpeg(uint8_t* out, size_t max, uint16_t w, uint16_t h) {
+  static const uint8_t sof[] = {0xFF, 0xC0, 0x00, 0x11, 0x08};
+  static const uint8_t comps[] = {0x03, 0x01, 0x22, 0x00, 0x02,
+                                  0x11, 0x00, 0x03, 0x11, 0x00};
+  static const uint8_t sos[] = {0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00,
+                                0x02, 0x00, 0x03, 0x00, 0x00, 0x3F, 0x00};
+  size_t o = 0;
+
+  out[o++] = 0xFF;
+  out[o++] = 0xD8;
+  out[o++] = 0xFF;
+  out[o++] = 0xDB;
+  out[o++] = 0x00;
+  out[o++] = 0x43;
+  out[o++] = 0x00;
+  memset(out + o, 1, 64);
+  o += 64;
+  memcpy(out + o, sof, sizeof(sof));
+  o += sizeof(sof);
+  out[o++] = h >> 8;
+  out[o++] = h;
+  out[o++] = w >> 8;
+  out[o++] = w;
+  memcpy(out + o, comps, sizeof(comps));
+  o += sizeof(comps);
+  out[o++] = 0xFF;
+  out[o++] = 0xC4;
+  out[o++] = 0x00;
+  out[o++] = 2 + 2 * 18;
+  for (uint8_t t = 0; t < 2; t++) {
+    /* DC then AC table 0, one code of length 1 for symbol 0 */
+    out[o++] = t << 4;
+    out[o++] = 1;
+    memset(out + o, 0, 16);
+    o += 16;
+  }
+  memcpy(out + o, sos, sizeof(sos));
+  o += sizeof(sos);
+
+  uint32_t bits = (uint32_t)((w + 15) / 16) * ((h + 15) / 16) * 12;
+  if (o + bits / 8 + 3 > max) {
+    memset(out + o, 0, max - o);
+    return max;
+  }
+  memset(out + o, 0, bits / 8);
+  o += bits / 8;
+  if (bits % 8)
+    out[o++] = 0xFF >> (bits % 8); /* Padded with one bits */
+  out[o++] = 0xFF;
+  out[o++] = 0xD9;
+  return o;
+}
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_480x272));
+  tft.graphicsMode();
+
+  static const tsJpegFile_t files[] = {
+      {"4:2:0", jpeg420, sizeof(jpeg420), 27, 19, 0x18A97784UL},
+      {"4:4:4", jpeg444, sizeof(jpeg444), 13, 11, 0xA4F01D4DUL},
+      {"4:2:2 restart", jpeg422r, sizeof(jpeg422r), 21, 17, 0xFB252277UL}};
+
+  for (uint8_t f = 0; f < sizeof(files) / sizeof(files[0]); f++) {
+    const tsJpegFile_t& jf = files[f];
+
+    /* The reference decode at every rotation, with the border untouched */
+    for (uint8_t r = 0; r < 4; r++) {
+      tft.setRotation(r);
+      tft.fillScreen(BG);
+      BufferStream in(jf.data, jf.len);
+      CHECK(tft.drawJPEG(in, IMG_X, IMG_Y));
+      if (screenHash(tft, IMG_X, IMG_Y, jf.w, jf.h) != jf.hash) {
+        printf("%s differs at rotation %d\n", jf.name, r);
+        testFailures++;
+      }
+      uint16_t px[2];
+      CHECK(tft.readPixels(IMG_X - 1, IMG_Y, 1, 1, &px[0]));
+      CHECK(tft.readPixels(IMG_X + jf.w, IMG_Y + jf.h - 1, 1, 1, &px[1]));
+      CHECK(px[0] == BG && px[1] == BG);
+    }
+
+    /* Partly off screen, the visible part matches the whole image */
+    static uint16_t whole[64 * 64], part[64 * 64];
+    tft.setRotation(0);
+    BufferStream in(jf.data, jf.len);
+    CHECK(tft.drawJPEG(in, 0, 0));
+    CHECK(tft.readPixels(5, 3, jf.w - 5, jf.h - 3, whole));
+    tft.fillScreen(BG);
+    BufferStream clipped(jf.data, jf.len);
+    CHECK(tft.drawJPEG(clipped, -5, -3));
+    CHECK(tft.readPixels(0, 0, jf.w - 5, jf.h - 3, part));
+    CHECK(!memcmp(whole, part, (jf.w - 5) * (jf.h - 3) * 2));
+
+    /* Cut short in the header and in the scan */
+    BufferStream header(jf.data, 40);
+    CHECK(!tft.drawJPEG(header, IMG_X, IMG_Y));
+    BufferStream scan(jf.data, jf.len - 60);
+    CHECK(!tft.drawJPEG(scan, IMG_X, IMG_Y));
+  }
+
+  /* The widest image the decoder takes ends in a partial MCU at 0x7FFF */
+  static uint8_t flat[FLAT_MAX];
+  size_t len = flatJpeg(flat, FLAT_MAX, 0x7FFF, 16);
+  CHECK(flat[len - 1] == 0xD9);
+  tft.fillScreen(BG);
+  BufferStream wide(flat, len);
+  CHECK(tft.drawJPEG(wide, 0, 0));
+  CHECK(RA8875Emu.pixel(0, 0) == 0x8410);
+  CHECK(RA8875Emu.pixel(479, 15) == 0x8410);
+  CHECK(RA8875Emu.pixel(0, 16) == BG);
+
+  /* A truncated image of the largest size ends without drawing it all */
+  len = flatJpeg(flat, FLAT_MAX, 0x7FFF, 0x7FFF);
+  BufferStream tall(flat, len);
+  CHECK(!tft.drawJPEG(tall, 0, 0));
+
+  /* Larger sizes are refused */
+  len = flatJpeg(flat, FLAT_MAX, 0x8000, 16);
+  BufferStream wider(flat, len);
+  CHECK(!tft.drawJPEG(wider, 0, 0));
+
+  return testResult("test_jpeg");
+}
@@ -0,0 +1,76 @@
+/*!
+ * @file test_layers.cpp
+ *
+ * Double buffering on the 800x480 panel at 8bpp: present() shows the back
+ * buffer and swaps the layers, and copies the new front buffer into the
+ * new back buffer on request. Going back to 16bpp must turn the second
+ * layer and double buffering off, after which present() leaves the bus
+ * alone and the asset cache can be set again.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define RED332 0xE0   ///< RA8875_RED at 8bpp
+#define GREEN332 0x1C ///< RA8875_GREEN at 8bpp
+#define BLUE332 0x03  ///< RA8875_BLUE at 8bpp
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_800x480));
+  tft.graphicsMode();
+
+  /* Two 16bpp layers do not fit, and present() is a no-op without them */
+  CHECK(!tft.setDoubleBuffer(true));
+  RA8875Emu.clearStats();
+  tft.present(true);
+  CHECK(RA8875Emu.stats().frames == 0);
+  CHECK(tft.getDisplayLayer() == RA8875_LAYER1);
+
+  /* The first frame goes to layer 2 while layer 1 is shown */
+  CHECK(tft.setColorDepth(8));
+  CHECK(tft.setDoubleBuffer(true));
+  CHECK(!tft.setAssetCache(RA8875_LAYER1, 0, 400, 100, 80));
+  CHECK(tft.getDisplayLayer() == RA8875_LAYER1);
+  CHECK(tft.getLayer() == RA8875_LAYER2);
+  tft.setLayer(RA8875_LAYER1);
+  tft.fillScreen(RA8875_BLUE);
+  tft.setLayer(RA8875_LAYER2);
+  tft.fillScreen(RA8875_RED);
+  CHECK(RA8875Emu.pixel(10, 10, 1) == RED332);
+  CHECK(RA8875Emu.pixel(10, 10, 0) == BLUE332);
+
+  /* Without preserve the new back buffer keeps its old contents */
+  tft.present(false);
+  CHECK(tft.getDisplayLayer() == RA8875_LAYER2);
+  CHECK(tft.getLayer() == RA8875_LAYER1);
+  CHECK((RA8875Emu.reg(RA8875_LTPR0) & RA8875_LTPR0_DISPMASK) ==
+        RA8875_LTPR0_LAYER2);
+  CHECK(RA8875Emu.pixel(10, 10, 0) == BLUE332);
+  CHECK(RA8875Emu.pixel(10, 10, 1) == RED332);
+
+  /* With preserve the whole front buffer is copied into the back buffer */
+  tft.fillRect(0, 0, 20, 20, RA8875_GREEN);
+  tft.present(true);
+  CHECK(tft.getDisplayLayer() == RA8875_LAYER1);
+  CHECK(tft.getLayer() == RA8875_LAYER2);
+  CHECK(RA8875Emu.pixel(10, 10, 1) == GREEN332);
+  CHECK(RA8875Emu.pixel(20, 20, 1) == BLUE332);
+  CHECK(RA8875Emu.pixel(799, 479, 1) == BLUE332);
+  CHECK(RA8875Emu.pixel(10, 10, 0) == GREEN332);
+
+  /* 16bpp turns the second layer and double buffering off */
+  CHECK(tft.setColorDepth(16));
+  CHECK(!(RA8875Emu.reg(RA8875_DPCR) & RA8875_DPCR_LAYERS2));
+  CHECK(tft.getLayer() == RA8875_LAYER1);
+  CHECK(tft.getDisplayLayer() == RA8875_LAYER1);
+  RA8875Emu.clearStats();
+  tft.present(true);
+  CHECK(RA8875Emu.stats().frames == 0);
+  CHECK(tft.getLayer() == RA8875_LAYER1);
+  CHECK(tft.setAssetCache(RA8875_LAYER1, 0, 400, 100, 80));
+
+  return testResult("test_layers");
+}
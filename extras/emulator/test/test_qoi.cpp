@@ -0,0 +1,262 @@
+/*!
+ * @file test_qoi.cpp
+ *
+ * Draws QOI images with drawQOI() and compares every pixel in display
+ * memory with a reference decode. A hand-assembled image pins each opcode
+ * to pixel values worked out from the QOI specification. Larger images are
+ * made with the reference encoder from the specification, so their decode
+ * is the source image, and the test checks that they use the index, diff,
+ * luma, run, RGB and RGBA opcodes and have runs that cross row boundaries.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define QOI_MAX 8192 ///< Largest encoded test image in bytes
+
+/**************************************************************************/
+/*!
+    @brief  Opcodes written by the reference encoder
+*/
+/**************************************************************************/
+typedef struct {
+  uint16_t index;      ///< QOI_OP_INDEX
+  uint16_t diff;       ///< QOI_OP_DIFF
+  uint16_t luma;       ///< QOI_OP_LUMA
+  uint16_t run;        ///< QOI_OP_RUN
+  uint16_t rgb;        ///< QOI_OP_RGB
+  uint16_t rgba;       ///< QOI_OP_RGBA
+  uint16_t crossRuns;  ///< Runs that end on a later row than they start
+} tsQoiOps_t;
+
+/**************************************************************************/
+/*!
+    @brief  Stores a big-endian 32-bit value
+*/
+/**************************************************************************/
+static void putBE(uint8_t* p, uint32_t v) {
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+/**************************************************************************/
+/*!
+    @brief  The reference encoder of the QOI specification
+
+    @param rgba     The w * h RGBA pixels
+    @param w        The image width
+    @param h        The image height
+    @param channels 3 or 4, only stored in the header
+    @param out      The buffer for the encoded image
+    @param ops      Counts of the opcodes written
+
+    @return The size of the encoded image
+*/
+/**************************************************************************/
+static size_t qoiEncode(const uint8_t* rgba, uint32_t w, uint32_t h,
+                        uint8_t channels, uint8_t* out, tsQoiOps_t& ops) {
+  uint8_t index[64][4], prev[4] = {0, 0, 0, 255};
+  uint32_t n = w * h, run = 0;
+  size_t o = 0;
+
+  memset(index, 0, sizeof(index));
+  memset(&ops, 0, sizeof(ops));
+  memcpy(out, "qoif", 4);
+  putBE(out + 4, w);
+  putBE(out + 8, h);
+  out[12] = channels;
+  out[13] = 0;
+  o = 14;
+
+  for (uint32_t i = 0; i < n; i++) {
+    const uint8_t* px = rgba + i * 4;
+    if (!memcmp(px, prev, 4)) {
+      run++;
+      if ((run == 62) || (i == n - 1)) {
+        out[o++] = 0xC0 | (run - 1);
+        ops.run++;
+        if ((i - run + 1) / w != i / w)
+          ops.crossRuns++;
+        run = 0;
+      }
+      continue;
+    }
+
+    if (run) {
+      out[o++] = 0xC0 | (run - 1);
+      ops.run++;
+      if ((i - run) / w != (i - 1) / w)
+        ops.crossRuns++;
+      run = 0;
+    }
+
+    uint8_t hash = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) & 63;
+    if (!memcmp(index[hash], px, 4)) {
+      out[o++] = hash;
+      ops.index++;
+    } else if (px[3] != prev[3]) {
+      memcpy(index[hash], px, 4);
+      out[o++] = 0xFF;
+      memcpy(out + o, px, 4);
+      o += 4;
+      ops.rgba++;
+    } else {
+      memcpy(index[hash], px, 4);
+      int8_t vr = px[0] - prev[0], vg = px[1] - prev[1], vb = px[2] - prev[2];
+      int8_t vgr = vr - vg, vgb = vb - vg;
+      if ((vr > -3) && (vr < 2) && (vg > -3) && (vg < 2) && (vb > -3) &&
+          (vb < 2)) {
+        out[o++] = 0x40 | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2);
+        ops.diff++;
+      } else if ((vgr > -9) && (vgr < 8) && (vg > -33) && (vg < 32) &&
+                 (vgb > -9) && (vgb < 8)) {
+        out[o++] = 0x80 | (vg + 32);
+        out[o++] = ((vgr + 8) << 4) | (vgb + 8);
+        ops.luma++;
+      } else {
+        out[o++] = 0xFE;
+        memcpy(out + o, px, 3);
+        o += 3;
+        ops.rgb++;
+      }
+    }
+    memcpy(prev, px, 4);
+  }
+
+  static const uint8_t padding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+  memcpy(out + o, padding, sizeof(padding));
+  return o + sizeof(padding);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Compares the drawn image with the reference pixels
+
+    @param rgba The w * h reference RGBA pixels
+    @param w    The image width
+    @param h    The image height
+    @param x    Where the image was drawn
+    @param y    Where the image was drawn
+    @param name The image name for failure messages
+*/
+/**************************************************************************/
+static void compare(const uint8_t* rgba, int16_t w, int16_t h, int16_t x,
+                    int16_t y, const char* name) {
+  int16_t bad = 0;
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) {
+      if ((x + i < 0) || (y + j < 0) || (x + i >= RA8875Emu.width()) ||
+          (y + j >= RA8875Emu.height()))
+        continue;
+      const uint8_t* px = rgba + ((int32_t)j * w + i) * 4;
+      uint16_t want =
+          ((px[0] & 0xF8) << 8) | ((px[1] & 0xFC) << 3) | (px[2] >> 3);
+      uint16_t got = RA8875Emu.pixel(x + i, y + j);
+      if ((got != want) && (bad++ < 4))
+        printf("%s: pixel %d,%d is %04X, want %04X\n", name, i, j, got, want);
+    }
+  }
+  CHECK(bad == 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Makes a test image with smooth gradients for the diff and luma
+            opcodes, jumps for the RGB opcode, a few alternating colors for
+            the index opcode, long single color spans for runs, and alpha
+            changes for the RGBA opcode when alpha is set
+*/
+/**************************************************************************/
+static void makeImage(uint8_t* rgba, int16_t w, int16_t h, bool alpha) {
+  static const uint8_t colors[3][3] = {
+      {200, 30, 60}, {20, 180, 90}, {70, 70, 240}};
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) {
+      int32_t k = (int32_t)j * w + i;
+      uint8_t* px = rgba + k * 4;
+      px[3] = 255;
+      if (k % 97 < 40) {
+        /* Long runs, crossing rows */
+        px[0] = 10;
+        px[1] = 20 + (k / 97) * 3;
+        px[2] = 30;
+      } else if (j % 4 == 0) {
+        /* Alternating colors */
+        memcpy(px, colors[(i / 2) % 3], 3);
+      } else if (j % 4 == 1) {
+        /* Steps of one for the diff opcode */
+        px[0] = 100 + i % 2;
+        px[1] = 100 - (i % 3);
+        px[2] = 50 + i / 3;
+      } else if (j % 4 == 2) {
+        /* Larger steps for the luma opcode */
+        px[0] = i * 9;
+        px[1] = i * 11;
+        px[2] = i * 13;
+      } else {
+        /* Jumps for the RGB opcode */
+        px[0] = (i * 97) ^ (j * 31);
+        px[1] = (i * 53) ^ 0x5A;
+        px[2] = (i * 29) + j * 71;
+      }
+      if (alpha && (k % 23 == 0))
+        px[3] = 128;
+    }
+  }
+}
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_480x272));
+  tft.graphicsMode();
+
+  /* One of each opcode, with the pixels worked out by hand */
+  static const uint8_t spec[] = {
+      'q',  'o',  'i',  'f', 0,  0,   0, 4, 0, 0, 0, 2, 4, 0,
+      0xFE, 100,  50,   20,        // RGB: 100, 50, 20
+      0x72,                        // DIFF +1 -2 +0: 101, 48, 20
+      0x27,                        // INDEX 39: 100, 50, 20
+      0xC2,                        // RUN 3, across the row end
+      0xAA, 0x5D,                  // LUMA dg 10, dr 7, db 15: 107, 60, 35
+      0xFF, 1,    2,    3,   128,  // RGBA: 1, 2, 3, alpha ignored
+      0,    0,    0,    0,   0,  0,   0, 1};
+  static const uint8_t specPixels[8 * 4] = {
+      100, 50, 20, 255, 101, 48, 20, 255, 100, 50, 20, 255, 100, 50, 20, 255,
+      100, 50, 20, 255, 100, 50, 20, 255, 107, 60, 35, 255, 1,   2,  3,  128};
+  tft.fillScreen(RA8875_BLACK);
+  BufferStream specIn(spec, sizeof(spec));
+  CHECK(tft.drawQOI(specIn, 10, 20));
+  compare(specPixels, 4, 2, 10, 20, "spec");
+
+  /* Encoded images, RGB and RGBA, whole and clipped by the screen edge */
+  static uint8_t rgba[61 * 37 * 4], qoi[QOI_MAX];
+  tsQoiOps_t ops;
+  for (uint8_t channels = 3; channels <= 4; channels++) {
+    makeImage(rgba, 61, 37, channels == 4);
+    size_t len = qoiEncode(rgba, 61, 37, channels, qoi, ops);
+    CHECK(len <= QOI_MAX);
+    CHECK(ops.index && ops.diff && ops.luma && ops.run && ops.rgb);
+    CHECK(ops.crossRuns > 0);
+    CHECK((channels == 4) == (ops.rgba > 0));
+
+    tft.fillScreen(RA8875_BLACK);
+    BufferStream in(qoi, len);
+    CHECK(tft.drawQOI(in, 100, 50));
+    compare(rgba, 61, 37, 100, 50, channels == 3 ? "rgb" : "rgba");
+
+    tft.fillScreen(RA8875_BLACK);
+    BufferStream clipped(qoi, len);
+    CHECK(tft.drawQOI(clipped, -17, 250));
+    compare(rgba, 61, 37, -17, 250, channels == 3 ? "rgb edge" : "rgba edge");
+
+    /* Data cut short in the middle of the pixels */
+    BufferStream cut(qoi, len / 2);
+    CHECK(!tft.drawQOI(cut, 100, 50));
+  }
+
+  return testResult("test_qoi");
+}
@@ -0,0 +1,96 @@
+/*!
+ * @file test_readback.cpp
+ *
+ * Draws into display memory and reads it back with readPixels() at every
+ * rotation and both color depths. This covers the read cursor, MRCD and
+ * the dummy byte of each read frame on the emulator side, and the row order
+ * and byte order of the library's read path.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define BMP_W 23  ///< Bitmap width, odd to catch row wrapping errors
+#define BMP_H 17  ///< Bitmap height
+#define BMP_X 37  ///< Bitmap x location
+#define BMP_Y 21  ///< Bitmap y location
+#define BG 0x0841 ///< Background color around the bitmap
+
+/**************************************************************************/
+/*!
+    @brief  The RGB565 color an 8bpp read returns for an RGB565 color
+*/
+/**************************************************************************/
+static uint16_t via332(uint16_t c) {
+  uint8_t r = c >> 13, g = (c >> 8) & 0x07, b = (c >> 3) & 0x03;
+  return ((r << 2 | r >> 1) << 11) | ((g << 3 | g) << 5) |
+         (b << 3 | b << 1 | b >> 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws the bitmap on a filled background and reads back an area
+            with a border of background pixels around it
+*/
+/**************************************************************************/
+static void roundTrip(Adafruit_RA8875& tft, const uint16_t* bmp, bool rgb332) {
+  static uint16_t buf[(BMP_W + 8) * (BMP_H + 8)];
+  const int16_t w = BMP_W + 8, h = BMP_H + 8;
+
+  tft.fillRect(BMP_X - 10, BMP_Y - 10, BMP_W + 20, BMP_H + 20, BG);
+  tft.drawRGBBitmap(BMP_X, BMP_Y, bmp, BMP_W, BMP_H);
+  memset(buf, 0xAA, sizeof(buf));
+  CHECK(tft.readPixels(BMP_X - 4, BMP_Y - 4, w, h, buf));
+
+  int16_t bad = 0;
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) {
+      int16_t bx = i - 4, by = j - 4;
+      uint16_t want = BG;
+      if ((bx >= 0) && (bx < BMP_W) && (by >= 0) && (by < BMP_H))
+        want = bmp[by * BMP_W + bx];
+      if (rgb332)
+        want = via332(want);
+      if ((buf[j * w + i] != want) && (bad++ < 4))
+        printf("rotation %d, %dbpp: pixel %d,%d is %04X, want %04X\n",
+               tft.getRotation(), rgb332 ? 8 : 16, i, j, buf[j * w + i],
+               want);
+    }
+  }
+  CHECK(bad == 0);
+}
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_480x272));
+  tft.graphicsMode();
+
+  /* Distinct high and low bytes in every pixel */
+  static uint16_t bmp[BMP_W * BMP_H];
+  for (int16_t j = 0; j < BMP_H; j++)
+    for (int16_t i = 0; i < BMP_W; i++)
+      bmp[j * BMP_W + i] = ((i * 11) << 11) | ((j * 3 + i) << 5) | (31 - j);
+
+  for (uint8_t r = 0; r < 4; r++) {
+    tft.setRotation(r);
+    roundTrip(tft, bmp, false);
+  }
+
+  /* Rectangles that are not entirely on screen are refused */
+  tft.setRotation(1);
+  uint16_t px;
+  CHECK(!tft.readPixels(-1, 0, 1, 1, &px));
+  CHECK(!tft.readPixels(tft.width() - 1, 0, 2, 1, &px));
+  CHECK(!tft.readPixels(0, tft.height(), 1, 1, &px));
+  CHECK(tft.readPixels(tft.width() - 1, tft.height() - 1, 1, 1, &px));
+
+  CHECK(tft.setColorDepth(8));
+  for (uint8_t r = 0; r < 4; r++) {
+    tft.setRotation(r);
+    roundTrip(tft, bmp, true);
+  }
+
+  return testResult("test_readback");
+}
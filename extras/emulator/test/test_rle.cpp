@@ -0,0 +1,236 @@
+/*!
+ * @file test_rle.cpp
+ *
+ * Draws RLE images with drawRLEBitmap() and compares display memory with
+ * the known pixels. A hand-assembled image pins the literal, short run and
+ * long run tokens, with a run across the row end. A larger image is made
+ * with a port of extras/rle_encode.py and has runs long enough for the
+ * fill engine, whole rows of one color and literals split at 128. Data
+ * that is cut short or uses an index past the palette is refused, and
+ * tokens that run past the last pixel must not draw outside the image.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define IMG_W 70     ///< Generated image width
+#define IMG_H 40     ///< Generated image height
+#define BG 0x0841    ///< Screen color around the images
+#define RLE_MAX 4096 ///< Largest encoded test image in bytes
+
+/// Palette of the generated image
+static const uint16_t palette[] = {RA8875_BLACK, RA8875_WHITE, RA8875_RED,
+                                   RA8875_GREEN, RA8875_BLUE,  0x1234,
+                                   0xABCD,       0x7BEF};
+
+/**************************************************************************/
+/*!
+    @brief  Palette index of a generated image pixel: whole rows of one
+            color, long runs, and noise that goes into literals
+*/
+/**************************************************************************/
+static uint8_t source(int16_t x, int16_t y) {
+  if (y < 3)
+    return 1;
+  if (y % 8 == 3)
+    return (x < 50) ? 2 : 3;
+  if (y % 8 < 6)
+    return ((x * 7 + y * 3) ^ (x >> 2)) % 8;
+  return (x / 20 + y) % 8;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Appends a run token, as extras/rle_encode.py writes it
+*/
+/**************************************************************************/
+static size_t putRun(uint8_t* out, size_t o, uint32_t n, uint8_t index) {
+  uint32_t n1 = n - 1;
+  if (n1 < 64) {
+    out[o++] = 0x80 | n1;
+  } else {
+    out[o++] = 0xC0 | (n1 & 0x3F);
+    out[o++] = n1 >> 6;
+  }
+  out[o++] = index;
+  return o;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Encodes the generated image like extras/rle_encode.py
+
+    @param out   The buffer for the encoded image
+    @param runs  Set to the number of runs long enough for the fill engine
+    @param split Set to the number of literals cut at 128 indices
+
+    @return The size of the encoded image
+*/
+/**************************************************************************/
+static size_t rleEncode(uint8_t* out, uint16_t& runs, uint16_t& split) {
+  static uint8_t idx[IMG_W * IMG_H];
+  const uint8_t colors = sizeof(palette) / sizeof(palette[0]);
+  const uint32_t n = IMG_W * IMG_H;
+  for (uint32_t i = 0; i < n; i++)
+    idx[i] = source(i % IMG_W, i / IMG_W);
+
+  size_t o = 0;
+  out[o++] = 'R';
+  out[o++] = 'P';
+  out[o++] = IMG_W & 0xFF;
+  out[o++] = IMG_W >> 8;
+  out[o++] = IMG_H & 0xFF;
+  out[o++] = IMG_H >> 8;
+  out[o++] = colors - 1;
+  for (uint8_t c = 0; c < colors; c++) {
+    out[o++] = palette[c] & 0xFF;
+    out[o++] = palette[c] >> 8;
+  }
+
+  runs = split = 0;
+  size_t lit = 0;
+  uint8_t litLen = 0;
+  for (uint32_t i = 0; i < n;) {
+    uint32_t len = 1;
+    while ((i + len < n) && (len < (1 << 14)) && (idx[i + len] == idx[i]))
+      len++;
+    if (len >= 3) {
+      if (litLen) {
+        out[lit] = litLen - 1;
+        litLen = 0;
+      }
+      if (len >= RA8875_RLE_FILL_MIN)
+        runs++;
+      o = putRun(out, o, len, idx[i]);
+      i += len;
+      continue;
+    }
+    if (!litLen)
+      lit = o++;
+    out[o++] = idx[i++];
+    if (++litLen == 128) {
+      out[lit] = 127;
+      litLen = 0;
+      split++;
+    }
+  }
+  if (litLen)
+    out[lit] = litLen - 1;
+  return o;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Compares the drawn generated image, and the background pixels
+            around it, with the palette colors
+*/
+/**************************************************************************/
+static void compare(int16_t x, int16_t y, const char* name) {
+  int16_t bad = 0;
+  for (int16_t j = -1; j <= IMG_H; j++) {
+    for (int16_t i = -1; i <= IMG_W; i++) {
+      int16_t sx = x + i, sy = y + j;
+      if ((sx < 0) || (sy < 0) || (sx >= RA8875Emu.width()) ||
+          (sy >= RA8875Emu.height()))
+        continue;
+      bool in = (i >= 0) && (j >= 0) && (i < IMG_W) && (j < IMG_H);
+      uint16_t want = in ? palette[source(i, j)] : BG;
+      uint16_t got = RA8875Emu.pixel(sx, sy);
+      if ((got != want) && (bad++ < 4))
+        printf("%s: pixel %d,%d is %04X, want %04X\n", name, i, j, got, want);
+    }
+  }
+  CHECK(bad == 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Checks the 5x3 hand-assembled image at x, y and that the
+            background around it is untouched
+*/
+/**************************************************************************/
+static void compareSpec(int16_t x, int16_t y, const char* name) {
+  static const uint16_t want[3][5] = {
+      {RA8875_RED, RA8875_GREEN, RA8875_BLUE, RA8875_GREEN, RA8875_GREEN},
+      {RA8875_GREEN, RA8875_GREEN, RA8875_BLUE, RA8875_RED, RA8875_RED},
+      {RA8875_RED, RA8875_RED, RA8875_RED, RA8875_BLUE, RA8875_BLUE}};
+  int16_t bad = 0;
+  for (int16_t j = -1; j <= 3; j++) {
+    for (int16_t i = -1; i <= 5; i++) {
+      bool in = (i >= 0) && (j >= 0) && (i < 5) && (j < 3);
+      uint16_t got = RA8875Emu.pixel(x + i, y + j);
+      if ((got != (in ? want[j][i] : BG)) && (bad++ < 4))
+        printf("%s: pixel %d,%d is %04X\n", name, i, j, got);
+    }
+  }
+  CHECK(bad == 0);
+}
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+  CHECK(tft.begin(RA8875_480x272));
+  tft.graphicsMode();
+
+  /* 5x3, one of each token, with the pixels worked out by hand */
+  static const uint8_t spec[] = {
+      'R',  'P',  5,    0,    3, 0, 2,    // 5x3, 3 colors
+      0x00, 0xF8, 0xE0, 0x07, 0x1F, 0x00, // Red, green, blue
+      0x02, 0,    1,    2,                // Literal: R G B
+      0x83, 1,                            // Run of 4 G, across the row end
+      0x00, 2,                            // Literal: B
+      0xC4, 0x00, 0,                      // Long run of 5 R
+      0x81, 2};                           // Run of 2 B
+  tft.fillScreen(BG);
+  CHECK(tft.drawRLEBitmap(10, 20, spec, sizeof(spec)));
+  compareSpec(10, 20, "spec");
+
+  /* Tokens running past the last pixel are cut at the image edge */
+  static uint8_t over[sizeof(spec)];
+  memcpy(over, spec, sizeof(spec));
+  over[sizeof(spec) - 2] = 0x80 | 40;
+  tft.fillScreen(BG);
+  CHECK(tft.drawRLEBitmap(10, 20, over, sizeof(over)));
+  compareSpec(10, 20, "run overrun");
+  static uint8_t literal[sizeof(spec) + 5];
+  memcpy(literal, spec, sizeof(spec) - 2);
+  static const uint8_t six[] = {0x05, 2, 2, 1, 1, 0, 0}; // 2 fit, 4 past
+  memcpy(literal + sizeof(spec) - 2, six, sizeof(six));
+  tft.fillScreen(BG);
+  CHECK(tft.drawRLEBitmap(10, 20, literal, sizeof(literal)));
+  compareSpec(10, 20, "literal overrun");
+
+  /* Data cut short in a token, in a palette, and a bad index */
+  tft.fillScreen(BG);
+  CHECK(!tft.drawRLEBitmap(10, 20, spec, sizeof(spec) - 1));
+  CHECK(!tft.drawRLEBitmap(10, 20, spec, sizeof(spec) - 2));
+  CHECK(!tft.drawRLEBitmap(10, 20, spec, 9));
+  CHECK(!tft.drawRLEBitmap(10, 20, spec, 5));
+  over[sizeof(spec) - 1] = 3;
+  CHECK(!tft.drawRLEBitmap(10, 20, over, sizeof(over)));
+  over[0] = 'X';
+  CHECK(!tft.drawRLEBitmap(10, 20, over, sizeof(over)));
+
+  /* An encoded image, whole and clipped by the screen edges */
+  static uint8_t rle[RLE_MAX];
+  uint16_t runs, split;
+  size_t len = rleEncode(rle, runs, split);
+  CHECK(len <= RLE_MAX);
+  CHECK((runs > 0) && (split > 0));
+
+  tft.fillScreen(BG);
+  CHECK(tft.drawRLEBitmap(100, 50, rle, len));
+  compare(100, 50, "encoded");
+  tft.fillScreen(BG);
+  CHECK(tft.drawRLEBitmap(-13, -7, rle, len));
+  compare(-13, -7, "encoded top-left");
+  tft.fillScreen(BG);
+  CHECK(tft.drawRLEBitmap(480 - 30, 272 - 20, rle, len));
+  compare(480 - 30, 272 - 20, "encoded bottom-right");
+
+  /* Cut short in the middle of the pixels */
+  CHECK(!tft.drawRLEBitmap(100, 50, rle, len / 2));
+
+  return testResult("test_rle");
+}
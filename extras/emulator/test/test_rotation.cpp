@@ -0,0 +1,146 @@
+/*!
+ * @file test_rotation.cpp
+ *
+ * Checks that a rotation set before begin() stays off the bus and is
+ * applied by begin(), and that overlapping BTE moves come out right in
+ * every direction at every rotation, with RA8875_BTE_AUTO and, at the
+ * portrait rotations, with an explicit direction as well. Text written in
+ * text mode must look the same as at rotation 0 once the panel is turned,
+ * which checks the font rotation and the panel scan direction together.
+ *
+ * BSD license, all text above must be included in any redistribution
+ */
+
+#include "test.h"
+
+#define AREA 40   ///< Side of the patterned square the moves work on
+#define SIZE 24   ///< Side of the moved rectangle
+#define BASE 8    ///< Offset of the moved rectangle in the square
+#define TEXT_X 10 ///< Logical x of the rotated text
+#define TEXT_Y 20 ///< Logical y of the rotated text
+#define TEXT_W 24 ///< Width of the area compared around the text
+#define TEXT_H 20 ///< Height of the area compared around the text
+
+/**************************************************************************/
+/*!
+    @brief  Pattern color for a logical pixel, unique within the square
+*/
+/**************************************************************************/
+static uint16_t pattern(int16_t x, int16_t y) {
+  return 0x1000 + y * AREA + x;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Moves a rectangle by dx, dy within the patterned square and
+            compares the square with the result of copying from a snapshot
+*/
+/**************************************************************************/
+static void overlapMove(Adafruit_RA8875& tft, int8_t dx, int8_t dy,
+                        enum RA8875bteDir dir) {
+  static uint16_t sq[AREA * AREA], got[AREA * AREA];
+  for (int16_t y = 0; y < AREA; y++)
+    for (int16_t x = 0; x < AREA; x++)
+      sq[y * AREA + x] = pattern(x, y);
+  tft.drawRGBBitmap(0, 0, sq, AREA, AREA);
+
+  tft.bteMove(BASE, BASE, BASE + dx, BASE + dy, SIZE, SIZE, dir);
+  for (int16_t y = 0; y < SIZE; y++)
+    for (int16_t x = 0; x < SIZE; x++)
+      sq[(BASE + dy + y) * AREA + BASE + dx + x] = pattern(BASE + x, BASE + y);
+
+  CHECK(tft.readPixels(0, 0, AREA, AREA, got));
+  if (memcmp(sq, got, sizeof(sq))) {
+    printf("rotation %d, move %d,%d, dir %d differs\n", tft.getRotation(), dx,
+           dy, dir);
+    testFailures++;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  The panel pixel showing a logical pixel at the current rotation
+*/
+/**************************************************************************/
+static uint16_t shown(Adafruit_RA8875& tft, int16_t x, int16_t y) {
+  int16_t w = RA8875Emu.width(), h = RA8875Emu.height();
+  switch (tft.getRotation()) {
+    case 1:
+      return RA8875Emu.screenPixel(w - 1 - y, x);
+    case 2:
+      return RA8875Emu.screenPixel(w - 1 - x, h - 1 - y);
+    case 3:
+      return RA8875Emu.screenPixel(y, h - 1 - x);
+  }
+  return RA8875Emu.screenPixel(x, y);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes two characters in text mode at TEXT_X, TEXT_Y and saves
+            the area around them as the panel shows it
+*/
+/**************************************************************************/
+static void drawText(Adafruit_RA8875& tft, uint16_t* out) {
+  tft.fillScreen(RA8875_BLACK);
+  tft.textMode();
+  tft.textSetCursor(TEXT_X, TEXT_Y);
+  tft.textColor(RA8875_YELLOW, RA8875_BLUE);
+  tft.textWrite("Ab");
+  tft.graphicsMode();
+  for (int16_t y = 0; y < TEXT_H; y++)
+    for (int16_t x = 0; x < TEXT_W; x++)
+      out[y * TEXT_W + x] = shown(tft, TEXT_X - 2 + x, TEXT_Y - 2 + y);
+}
+
+int main(void) {
+  Adafruit_RA8875 tft(TEST_CS, TEST_RST);
+  RA8875Emu.setCsPin(TEST_CS);
+
+  /* The rotation is only cached until begin() */
+  RA8875Emu.clearStats();
+  tft.setRotation(1);
+  CHECK(RA8875Emu.stats().frames == 0);
+  CHECK(tft.begin(RA8875_480x272));
+  CHECK(tft.getRotation() == 1);
+  CHECK(tft.width() == 272 && tft.height() == 480);
+  CHECK(RA8875Emu.reg(0x22) & (1 << 4));
+  tft.graphicsMode();
+
+  static const int8_t moves[8][2] = {{3, 0},  {-3, 0}, {0, 3},  {0, -3},
+                                     {3, 2},  {-3, 2}, {3, -2}, {-3, -2}};
+  for (uint8_t r = 0; r < 4; r++) {
+    tft.setRotation(r);
+    CHECK(((RA8875Emu.reg(0x22) >> 4) & 1) == (r & 1));
+    for (uint8_t m = 0; m < 8; m++) {
+      overlapMove(tft, moves[m][0], moves[m][1], RA8875_BTE_AUTO);
+      if (r & 1) {
+        overlapMove(tft, moves[m][0], moves[m][1], RA8875_BTE_FORWARD);
+        overlapMove(tft, moves[m][0], moves[m][1], RA8875_BTE_BACKWARD);
+      }
+    }
+  }
+
+  /* Text at every rotation matches rotation 0 with the panel turned */
+  static const uint8_t scan[4] = {0x00, 0x08, 0x0C, 0x04};
+  static uint16_t ref[TEXT_W * TEXT_H], got[TEXT_W * TEXT_H];
+  tft.setRotation(0);
+  drawText(tft, ref);
+  CHECK(ref[(TEXT_H / 2) * TEXT_W + 4] == RA8875_YELLOW);
+  CHECK(ref[4 * TEXT_W + 8] == RA8875_BLUE);
+  CHECK(ref[0] == RA8875_BLACK);
+  for (uint8_t r = 1; r < 4; r++) {
+    tft.setRotation(r);
+    CHECK((RA8875Emu.reg(0x20) & 0x0C) == scan[r]);
+    drawText(tft, got);
+    if (memcmp(ref, got, sizeof(ref))) {
+      printf("rotation %d, text differs\n", r);
+      testFailures++;
+    }
+  }
+  tft.setRotation(0);
+  CHECK((RA8875Emu.reg(0x20) & 0x0C) == 0);
+  CHECK(!(RA8875Emu.reg(0x22) & (1 << 4)));
+
+  return testResult("test_rotation");
+}
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Convert an image to an RLE + palette C array for drawRLEBitmap().
+
+Usage: rle_encode.py image.png name > name.h
+
+Images with more than 256 RGB565 colors are quantized to 256. See
+Adafruit_RA8875::drawRLEBitmap() for the data format. Requires Pillow.
+"""
+
+import argparse
+import collections
+import sys
+
+from PIL import Image
+
+MAX_RUN = 1 << 14  # 6 bits in the token plus an 8-bit extension byte
+MAX_LITERAL = 128
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def palettize(img):
+    """Returns the RGB565 palette and the palette index of each pixel."""
+    img = img.convert("RGB")
+    colors = [rgb565(*p) for p in img.getdata()]
+    if len(set(colors)) > 256:
+        print("more than 256 colors, quantizing", file=sys.stderr)
+        img = img.quantize(256).convert("RGB")
+        colors = [rgb565(*p) for p in img.getdata()]
+    palette = [c for c, _ in collections.Counter(colors).most_common()]
+    lookup = {c: i for i, c in enumerate(palette)}
+    return palette, [lookup[c] for c in colors]
+
+
+def encode(indices):
+    """Returns the token stream for a list of palette indices."""
+    out = bytearray()
+    literal = []
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            out.extend(literal)
+            del literal[:]
+
+    i = 0
+    while i < len(indices):
+        n = 1
+        while (i + n < len(indices) and n < MAX_RUN
+               and indices[i + n] == indices[i]):
+            n += 1
+        # A run costs 2 or 3 bytes, so shorter repeats go in literals
+        if n >= 3:
+            flush()
+            n1 = n - 1
+            if n1 < 64:
+                out += bytes([0x80 | n1])
+            else:
+                out += bytes([0xC0 | (n1 & 0x3F), n1 >> 6])
+            out.append(indices[i])
+            i += n
+            continue
+        literal.append(indices[i])
+        if len(literal) == MAX_LITERAL:
+            flush()
+        i += 1
+    flush()
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("image")
+    parser.add_argument("name", help="C array name")
+    args = parser.parse_args()
+
+    img = Image.open(args.image)
+    w, h = img.size
+    if w > 0x7FFF or h > 0x7FFF:
+        sys.exit("image too large")
+    palette, indices = palettize(img)
+
+    data = bytearray(b"RP")
+    data += bytes([w & 0xFF, w >> 8, h & 0xFF, h >> 8, len(palette) - 1])
+    for c in palette:
+        data += bytes([c & 0xFF, c >> 8])
+    data += encode(indices)
+
+    print("// %s: %dx%d, %d colors, %d bytes (raw RGB565 is %d)"
+          % (args.image, w, h, len(palette), len(data), w * h * 2))
+    print("// Draw with tft.drawRLEBitmap(x, y, %s, sizeof(%s))"
+          % (args.name, args.name))
+    print("const uint8_t %s[] PROGMEM = {" % args.name)
+    for i in range(0, len(data), 12):
+        print("  " + ", ".join("0x%02X" % b for b in data[i:i + 12]) + ",")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()